@@ -0,0 +1,206 @@
+/** @file BenchmarkGames.cpp
+ *
+ * Mede o custo da arbitragem (Games::Match::play), das estatísticas e dos
+ * campeonatos, com jogadores aleatórios (que praticamente não "pensam").
+ *
+ * O resultado é escrito na saída padrão em formato CSV, uma linha por medida:
+ *
+ * benchmark,game,players,workers,matches,moves,wall_ns,cpu_ns,think_ns,matches_per_sec,referee_share
+ *
+ * - <i>cpu_ns</i>: tempo de CPU do processo (todas as <i>threads</i>);
+ * - <i>think_ns</i>: soma dos custos das jogadas (tempo de CPU dos jogadores);
+ * - <i>referee_share</i>: fração do tempo de CPU gasta fora dos jogadores
+ * (arbitragem, estatísticas, alocação...), isto é, 1 - think_ns/cpu_ns.
+ *
+ * Uso: BenchmarkGames [número de partidas (padrão: 2000)]
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "PubRandomPlayer.h"
+#include "TicTacToeMatch.h"
+#include "TicTacToeRandomPlayer.h"
+#include "RoundRobinTournament.hpp"
+#include "SingleEliminationTournament.hpp"
+#include "MatchStats.hpp"
+
+using namespace Games;
+
+namespace {
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+const uint64_t SEED = 2012;
+
+// Cronômetro: tempo real e tempo de CPU do processo.
+class Stopwatch {
+public:
+	Stopwatch() : wall_start(std::chrono::steady_clock::now()) {
+		IIA::Utils::Time::get_cpu_time(cpu_start);
+	}
+
+	double wall_ns() const {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wall_start).count();
+	}
+
+	double cpu_ns() const {
+		timespec now;
+		IIA::Utils::Time::get_cpu_time(now);
+		return IIA::Utils::Time::to_nano(IIA::Utils::Time::time_diff(cpu_start, now));
+	}
+
+private:
+	std::chrono::steady_clock::time_point wall_start;
+	timespec cpu_start;
+};
+
+// Número de jogadas e tempo dos jogadores nas partidas dadas.
+template <class match_t>
+void count(const std::deque<match_t *> &matches, std::size_t &moves, double &think_ns) {
+	for(const match_t *match : matches) {
+		moves += match->moves.size();
+		for(auto move : match->moves) think_ns += move->action->cost;
+	}
+}
+
+// Escreve uma linha CSV.
+void report(const std::string &benchmark, const std::string &game, std::size_t players, unsigned int workers,
+			std::size_t matches, std::size_t moves, double wall_ns, double cpu_ns, double think_ns) {
+	std::ostringstream line;
+	line << std::fixed << std::setprecision(0)
+		 << benchmark << ',' << game << ',' << players << ',' << workers << ','
+		 << matches << ',' << moves << ',' << wall_ns << ',' << cpu_ns << ',' << think_ns << ','
+		 << (wall_ns > 0 ? 1e9 * matches / wall_ns : 0) << ',' << std::setprecision(3)
+		 << (cpu_ns > 0 ? 1 - think_ns / cpu_ns : 0);
+	std::cout << line.str() << std::endl;
+}
+
+// Partidas disputadas em sequência por dois jogadores.
+template <class match_t, class player_t>
+std::deque<match_t *> referee(const std::string &game, player_t &first, player_t &second, std::size_t num_matches) {
+	std::deque<player_t *> players;
+	players.push_back(&first), players.push_back(&second);
+
+	IIA::Utils::Random::set_seed(SEED, 0);
+	std::deque<match_t *> matches;
+
+	Stopwatch stopwatch;
+	for(std::size_t i = 0; i < num_matches; ++i) {
+		matches.push_back(new match_t(players));
+		matches.back()->play();
+	}
+	const double wall_ns = stopwatch.wall_ns(), cpu_ns = stopwatch.cpu_ns();
+
+	std::size_t moves = 0;
+	double think_ns = 0;
+	count(matches, moves, think_ns);
+	report("Match::play", game, players.size(), 1, matches.size(), moves, wall_ns, cpu_ns, think_ns);
+
+	return matches;
+}
+
+// Custo das estatísticas sobre as partidas dadas: recalculadas para cada
+// jogador (PlayerMultipleMatchStat), acumuladas partida a partida (Standings)
+// e a classificação completa (MultipleMatchStat).
+template <class match_t, class player_t>
+void statistics(const std::string &game, const std::deque<match_t *> &matches, player_t &first, player_t &second) {
+	std::size_t moves = 0;
+	double think_ns = 0;
+	count(matches, moves, think_ns);
+
+	{
+		Stopwatch stopwatch;
+		Statistics::PlayerMultipleMatchStat<match_t, player_t> first_stat(matches, &first), second_stat(matches, &second);
+		report("PlayerMultipleMatchStat", game, 2, 1, matches.size(), moves, stopwatch.wall_ns(), stopwatch.cpu_ns(), 0);
+	}
+	{
+		Stopwatch stopwatch;
+		Statistics::Standings<match_t, player_t> standings;
+		standings.add(matches);
+		report("Standings::add", game, 2, 1, matches.size(), moves, stopwatch.wall_ns(), stopwatch.cpu_ns(), 0);
+	}
+	{
+		Stopwatch stopwatch;
+		Statistics::MultipleMatchStat<match_t, player_t> stats(matches);
+		report("MultipleMatchStat", game, 2, 1, matches.size(), moves, stopwatch.wall_ns(), stopwatch.cpu_ns(), 0);
+	}
+}
+
+// Campeonato completo entre os jogadores dados.
+template <class tournament_t, class match_t, class player_t>
+void tournament(const std::string &name, const std::string &game, const std::deque<player_t *> &players,
+				unsigned int workers, unsigned int num_matches) {
+	tournament_t t(players, workers);
+	t.seed = SEED;
+
+	Stopwatch stopwatch;
+	t.run(num_matches);
+	const double wall_ns = stopwatch.wall_ns(), cpu_ns = stopwatch.cpu_ns();
+
+	std::size_t matches = 0, moves = 0;
+	double think_ns = 0;
+	for(const std::deque<std::deque<match_t *> > &round : t.rounds) {
+		for(const std::deque<match_t *> &dispute : round) {
+			matches += dispute.size();
+			count(dispute, moves, think_ns);
+		}
+	}
+	report(name, game, players.size(), workers, matches, moves, wall_ns, cpu_ns, think_ns);
+}
+
+void benchmark_pub(std::size_t num_matches) {
+	using namespace Pub;
+
+	PubRandomPlayer white(WHITE, "white"), black(BLACK, "black");
+	std::deque<PubMatch *> matches = referee<PubMatch, PubPlayer>("Pub", white, black, num_matches);
+	statistics<PubMatch, PubPlayer>("Pub", matches, white, black);
+	IIA::Utils::empty(matches);
+
+	// Os jogadores são guardados por valor (PubPlayer não tem destrutor
+	// virtual); push_back em std::deque não invalida os endereços.
+	std::deque<PubRandomPlayer> all;
+	std::deque<PubPlayer *> pointers;
+	for(int i = 0; i < 32; ++i) {
+		std::ostringstream id;
+		id << "Random" << i;
+		all.push_back(PubRandomPlayer(i % 2 ? BLACK : WHITE, id.str()));
+		pointers.push_back(&all.back());
+	}
+
+	std::vector<unsigned int> workers(1, 1);
+	if(IIA::Utils::ThreadPool::hardware_workers() > 1) workers.push_back(IIA::Utils::ThreadPool::hardware_workers());
+	for(std::size_t n = 2; n <= all.size(); n *= 2) {
+		std::deque<PubPlayer *> players(pointers.begin(), pointers.begin() + n);
+		for(unsigned int w : workers) {
+			tournament<RoundRobin<PubMatch, PubPlayer>, PubMatch>("RoundRobin", "Pub", players, w, 3);
+			tournament<SingleElimination<PubMatch, PubPlayer>, PubMatch>("SingleElimination", "Pub", players, w, 3);
+		}
+	}
+}
+
+void benchmark_tictactoe(std::size_t num_matches) {
+	using namespace TicTacToe;
+
+	RandomPlayer cross(CROSS, "cross"), nought(NOUGHT, "nought");
+	std::deque<TicTacToeMatch *> matches = referee<TicTacToeMatch, TicTacToePlayer>("TicTacToe", cross, nought, num_matches);
+	statistics<TicTacToeMatch, TicTacToePlayer>("TicTacToe", matches, cross, nought);
+	IIA::Utils::empty(matches);
+}
+/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
+} // unnamed namespace
+
+int main(int argc, char **argv) {
+	const std::size_t num_matches = (argc > 1 ? atoi(argv[1]) : 2000);
+
+	std::cout << "benchmark,game,players,workers,matches,moves,wall_ns,cpu_ns,think_ns,"
+				 "matches_per_sec,referee_share" << std::endl;
+	benchmark_pub(num_matches);
+	benchmark_tictactoe(num_matches);
+
+	return 0;
+}
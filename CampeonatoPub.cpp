@@ -63,19 +63,13 @@ void testa_campeonato() {
 	pub_players.push_back(&aluno1);
 	pub_players.push_back(&aluno2);
 
-	// criando/executando o campeonato
-	Games::RoundRobin<PubMatch, PubPlayer> pub_rr(pub_players);
+	// criando/executando o campeonato (disputas de cada rodada em paralelo)
+	Games::RoundRobin<PubMatch, PubPlayer> pub_rr(pub_players, IIA::Utils::ThreadPool::hardware_workers());
 	pub_rr.run();
 	// std::cout << "\n" << pub_rr << "\n";
 
 	// ordenando os participantes conforme a regra compare_win3draw1
-	std::deque<PubMatch *> matches;
-	for(std::deque<std::deque<PubMatch *> > round : pub_rr.rounds)
-		for(std::deque<PubMatch *> dispute : round)
-			for(PubMatch *match : dispute)
-				matches.push_back(match);
-
-	Statistics::MultipleMatchStat<PubMatch, PubPlayer> stats(matches);
+	Statistics::MultipleMatchStat<PubMatch, PubPlayer> stats(pub_rr.standings);
 	std::sort(stats.player_stats.begin(), stats.player_stats.end(), compare_win3draw1);
 	// std::cout << "\n" << stats << "\n";
 
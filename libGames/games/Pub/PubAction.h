@@ -46,6 +46,16 @@ public:
 		return "Marcar " + IIA::Utils::String::to_string(mark) + " (" + IIA::Utils::String::to_string(first) + ", " + IIA::Utils::String::to_string(second) + ")";
 	}
 
+	/** Codifica a ação em um inteiro (para Games::Log). */
+	uint64_t code() const {
+		return uint64_t(first) | (uint64_t(second) << 8) | (uint64_t(mark) << 16);
+	}
+
+	/** Retorna uma nova ação a partir do código dado (@see code()). */
+	static PubAction *from_code(uint64_t code, double cost) {
+		return new PubAction(code & 0xFF, (code >> 8) & 0xFF, Mark((code >> 16) & 0xFF), cost);
+	}
+
 	/** Converte a ação em string. */
 	friend std::ostream &operator <<(std::ostream &os, const PubAction &action) {
 		os << action.to_string();
@@ -61,18 +71,8 @@ public:
 	Mark mark;
 private: 
 	// Funções auxiliares
-	int get_empty_row(const PubState &game, const int col) const {
-		Games::Grids::Coord2D coord(0, col);
-		while(game.valid(coord) && game[coord] != EMPTY) ++coord.row;
-		return coord.row;
-	}
-
 	void mark_column(PubState &game, const int column, Mark mark) const {
-		Games::Grids::Coord2D coord(get_empty_row(game, column), column);
-		if(!game.valid(coord))
-			throw std::invalid_argument("Invalid column to mark.");
-
-		game[coord] = mark;
+		game.drop(column, mark); // O(1), lança exceção se a coluna estiver cheia
 	}
 };
 } // namespace Pub
@@ -0,0 +1,56 @@
+/** @file PubAlphaBetaPlayer.h
+ *
+ * Implementação do jogador PubAlphaBetaPlayer para Pub.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_PUB_ALPHABETAPLAYER_H
+#define GAMES_PUB_ALPHABETAPLAYER_H
+
+#include "AlphaBetaSearch.hpp"
+#include "PubMatch.h"
+#include "PubRules.h"
+#include "TranspositionTable.hpp"
+
+namespace Games {
+namespace Pub {
+/** Classe de jogador para Pub. Escolhe as jogadas com busca alfa-beta
+ * (Games::Search::AlphaBeta), aprofundando enquanto houver tempo. O jogador
+ * tem sua própria tabela de transposição, mantida entre as jogadas de uma
+ * partida (as entradas valem para qualquer posição). */
+class PubAlphaBetaPlayer : public PubPlayer {
+public:
+	/** Construtor. */
+	PubAlphaBetaPlayer(Mark m, /**< a marca do jogador */
+					   std::string id = "PubAlphaBetaPlayer", /**< nome do jogador */
+					   double budget_ns = MAX_TIME_COST_IN_NANOSECONDS/2 /**< tempo por jogada */)
+	: PubPlayer(m, id), budget(budget_ns), table(TABLE_SIZE) {}
+
+	/** Tempo de CPU (em nanossegundos) disponível para cada jogada. Deve ficar
+	 * abaixo de MAX_TIME_COST_IN_NANOSECONDS, com margem para o restante
+	 * de decide_action(). */
+	double budget;
+
+protected:
+	using PubPlayer::choose_play;
+
+	// overload
+	void choose_play(const PubState &state, int &first, int &second) {
+		PubRules::Position position(state, mark);
+		Games::Search::AlphaBeta<PubRules> engine(rules, table);
+		PubRules::Move move = engine.search(position, budget).move;
+
+		first = move.first, second = move.second;
+	}
+
+private:
+	static constexpr std::size_t TABLE_SIZE = 1 << 18; // 4 MB
+
+	PubRules rules;
+	Games::Search::TranspositionTable table;
+};
+} // namespace Pub
+} // namespace Games
+
+#endif // GAMES_PUB_ALPHABETAPLAYER_H
@@ -28,16 +28,10 @@ public:
 	GameResult get_result(const PubPlayer *player) const {
 		if(!IIA::Utils::contains(players, player)) return UNKNOWN;
 
-		if(moves.size() >= 20) {
-			PubState game = result();
-			return get_result(game, player->mark);
-		}
+		if(moves.size() >= 20) return get_result(result(), player->mark);
 
-		PubState game;
-		for(PubMatch::Move *move : moves) {
-			if(allowed(move, game)) move->execute(game);
-			else return (move->player == player ? DEFEAT : VICTORY);
-		}
+		const Move *invalid = invalid_move();
+		if(invalid) return (invalid->player == player ? DEFEAT : VICTORY);
 
 		return UNKNOWN;
 	}
@@ -48,18 +42,7 @@ public:
 	 * @param game jogo a ser verificado
 	 * @param mark símbolo a ser verificado. */
 	static unsigned int count_in_row(const PubState &game, const Mark mark)  {
-		unsigned int points = 0;
-		for(unsigned int r = 0; r < game.row_size(); ++r) {
-			Games::Grids::Coord2D c1(r, 1), c2(r,3);
-			if(game[c1] == mark && game[c2] == mark) {
-				c1.col = 0, c2.col = 2;
-				if(game[c1] == mark && game[c2] == mark) ++points;
-				c1.col = 4;
-				if(game[c1] == mark && game[c2] == mark) ++points;
-			}
-		}
-
-		return points;
+		return game.count_lines(mark, PubState::ROWS + 1);
 	}
 
 	/** Conta o número de pontos por coluna do estado dado como argumento.
@@ -67,18 +50,7 @@ public:
 	 * @param game jogo a ser verificado
 	 * @param mark símbolo a ser verificado. */
 	static unsigned int count_in_col(const PubState &game, const Mark mark) {
-		unsigned int points = 0;
-		for(unsigned int c = 0; c < game.col_size(); ++c) {
-			for(unsigned int r = 3; r < game.row_size(); ++r) {
-				Games::Grids::Coord2D c1(r, c), c2(r - 3, c);
-				if(game[c1] == mark && game[c2] == mark) {
-					c1.row--, c2.row++;
-					if(game[c1] == mark && game[c2] == mark) ++points;
-				}
-			}
-		}
-
-		return points;
+		return game.count_lines(mark, 1);
 	}
 
 	/** Conta o número de pontos nas diagonais do estado dado como argumento.
@@ -86,24 +58,7 @@ public:
 	 * @param game jogo a ser verificado
 	 * @param mark símbolo a ser verificado. */
 	static unsigned int count_in_diag(const PubState &game, const Mark mark)  {
-		unsigned int points = 0;
-
-		for(unsigned int c = 3; c < game.col_size(); ++c) {
-			for(unsigned int r = 3; r < game.row_size(); ++r) {
-				Games::Grids::Coord2D c1(r, c), c2(r - 3, c - 3);
-				if(game[c1] == mark && game[c2] == mark) {
-					c1.row--, c1.col--, c2.row++, c2.col++;
-					if(game[c1] == mark && game[c2] == mark) ++points;
-				}
-				c1.row = r - 3, c1.col = c, c2.row = r, c2.col = c - 3;
-				if(game[c1] == mark && game[c2] == mark) {
-					c1.row++, c1.col--, c2.row--, c2.col++;
-					if(game[c1] == mark && game[c2] == mark) ++points;
-				}
-			}
-		}
-
-		return points;
+		return game.count_lines(mark, PubState::ROWS + 2) + game.count_lines(mark, PubState::ROWS);
 	}
 
 	/** Conta o número total de pontos do estado dado como argumento.
@@ -141,13 +96,7 @@ protected:
 
 	/** Indica se a partida dada terminou. */
 	bool over(const PubState &game) {
-		Games::Grids::Coord2D coord;
-		for(coord.row = 0; coord.row < game.row_size(); ++coord.row) {
-			for(coord.col = game.col_size() - 1; coord.col >= 0; --coord.col) {
-				if(game[coord] == EMPTY) return false;
-			}
-		}
-		return true;
+		return game.full();
 	}
 
 	/** Retorna a referência para uma nova ação, que é inválida para o
@@ -164,13 +113,13 @@ protected:
 		if(move->action->cost > Games::Pub::MAX_TIME_COST_IN_NANOSECONDS) return false;
 		if(move->action->mark == EMPTY) return false;
 
-		Games::Grids::Coord2D coord(state.row_size() - 1, move->action->first);
-		if(!state.valid(coord) || state[coord] != EMPTY) return false;
-
-		if(coord.col == move->action->second) coord.row--;
-		else coord.col = move->action->second;
+		const unsigned int first = move->action->first, second = move->action->second;
+		if(first >= state.col_size() || second >= state.col_size()) return false;
 
-		if(!state.valid(coord) || state[coord] != EMPTY) return false;
+		// as duas bolas devem caber na(s) coluna(s)
+		const unsigned int balls = (first == second ? 2 : 1);
+		if(state.height(first) + balls > state.row_size()) return false;
+		if(state.height(second) + balls > state.row_size()) return false;
 
 		return true;
 	}
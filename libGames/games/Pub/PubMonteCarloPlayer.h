@@ -0,0 +1,98 @@
+/** @file PubMonteCarloPlayer.h
+ *
+ * Implementação do jogador PubMonteCarloPlayer para Pub.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_PUB_MONTECARLOPLAYER_H
+#define GAMES_PUB_MONTECARLOPLAYER_H
+
+#include <algorithm>
+
+#include "MonteCarloSearch.hpp"
+#include "PubMatch.h"
+#include "PubRules.h"
+
+namespace Games {
+namespace Pub {
+/** Classe de jogador para Pub. Escolhe as jogadas com busca em árvore Monte
+ * Carlo (Games::Search::MonteCarlo), com simulações sobre o <i>bitboard</i>.
+ *
+ * A árvore é reaproveitada entre as jogadas de uma partida: após cada busca, o
+ * jogador a reposiciona na própria jogada e, na jogada seguinte, na do
+ * adversário (PubState::last_action), desde que o tabuleiro recebido seja o
+ * esperado.
+ *
+ * O orçamento de cada jogada é dividido entre as <i>threads</i> da busca, e o
+ * tempo de CPU de todas elas compõe o custo da ação: mais <i>threads</i>
+ * reduzem o tempo de espera, mas não o limite de MAX_TIME_COST_IN_NANOSECONDS. */
+class PubMonteCarloPlayer : public PubPlayer {
+public:
+	/** Construtor. */
+	PubMonteCarloPlayer(Mark m, /**< a marca do jogador */
+						std::string id = "PubMonteCarloPlayer", /**< nome do jogador */
+						double budget_ns = MAX_TIME_COST_IN_NANOSECONDS/2, /**< tempo por jogada */
+						unsigned int num_workers = 1 /**< número de threads da busca */)
+	: PubPlayer(m, id), budget(budget_ns), engine(rules, num_workers), tracking(false) {}
+
+	/** Tempo de CPU (em nanossegundos) da busca para cada jogada, somado
+	 * entre as <i>threads</i>. */
+	double budget;
+
+	// overload
+	void start_new_match() {
+		engine.reset();
+		tracking = false;
+	}
+
+protected:
+	using PubPlayer::choose_play;
+
+	// overload
+	void choose_play(const PubState &state, int &first, int &second) {
+		if(tracking && !follow(state)) engine.reset();
+
+		PubRules::Position position(state, mark);
+		const unsigned int threads = engine.num_workers();
+		Games::Search::MonteCarlo<PubRules>::Result result = engine.search(position, budget/threads);
+		if(threads > 1) offloaded_ns = result.cpu_ns; // medido nas threads do ThreadPool
+
+		const PubRules::Move &move = result.move;
+		first = move.first, second = move.second;
+
+		engine.advance(move);
+		expected = state;
+		expected.drop(move.first, mark), expected.drop(move.second, mark);
+		tracking = true;
+	}
+
+private:
+	// Reposiciona a árvore na jogada do adversário, se o estado for o esperado.
+	bool follow(const PubState &state) {
+		const PubAction *action = state.last_action;
+		if(!action || action->mark == mark || action->first >= PubState::COLS || action->second >= PubState::COLS)
+			return false;
+
+		PubState after(expected);
+		try {
+			after.drop(action->first, action->mark), after.drop(action->second, action->mark);
+		} catch(std::invalid_argument e) {
+			return false;
+		}
+		if(!(after == state)) return false;
+
+		engine.advance(PubRules::Move(std::min(action->first, action->second), std::max(action->first, action->second)));
+		return true;
+	}
+
+	// Attributes
+	PubRules rules;
+	Games::Search::MonteCarlo<PubRules> engine;
+	PubState expected; // estado após a última jogada deste jogador
+	bool tracking;
+};
+} // namespace Pub
+} // namespace Games
+
+#endif // GAMES_PUB_MONTECARLOPLAYER_H
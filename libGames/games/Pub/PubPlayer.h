@@ -21,21 +21,22 @@ public:
 	PubPlayer(Mark m, /**< a marca do jogador */
 			  std::string name /**< nnome do jogador */
 			 )
-		: Games::Player<PubState>(name), mark(m) {}
+		: Games::Player<PubState>(name), mark(m), offloaded_ns(0) {}
 
 	/** Decide a ação a realizar dado o estado. */
 	IIA::Action<PubState> *decide_action(const PubState &state) {
-		/** Marca o tempo (em nanossegundos) para decisão da jogada e o define
-		 * como custo da ação. */
+		/** Marca o tempo (em nanossegundos) para decisão da jogada, somado ao
+		 * de outras threads (offloaded_ns), e o define como custo da ação. */
 		timespec start_time, end_time;
 		int first, second;
 
-		IIA::Utils::Time::get_cpu_time(start_time);
-		choose_play(state.last_action, first, second);
-		IIA::Utils::Time::get_cpu_time(end_time);
+		offloaded_ns = 0;
+		IIA::Utils::Time::get_thread_cpu_time(start_time);
+		choose_play(state, first, second);
+		IIA::Utils::Time::get_thread_cpu_time(end_time);
 
 		timespec diff = IIA::Utils::Time::time_diff(start_time, end_time);
-		double cost_in_ns = IIA::Utils::Time::to_nano(diff);
+		double cost_in_ns = IIA::Utils::Time::to_nano(diff) + offloaded_ns;
 
 		return new PubAction(first, second, mark, cost_in_ns);
 	}
@@ -49,11 +50,27 @@ public:
 	Mark mark;
 
 protected:
+	/** Tempo de CPU (em nanossegundos) gasto por outras <i>threads</i> na
+	 * decisão da jogada, que não é medido na <i>thread</i> do jogador. Deve
+	 * ser definido por choose_play() quando delegar trabalho. */
+	double offloaded_ns;
+
+	/** Define a jogada em função do estado do jogo. Por padrão, considera
+	 * apenas a última ação executada. */
+	virtual void choose_play(const PubState &state, /**< [in] o estado do jogo */
+							 int &first, /**< [out] a coordenada da coluna onde se deseja jogar primeiro */
+							 int &second /**< [out] a coordenada da coluna onde se deseja jogar segundo */
+							) {
+		choose_play(state.last_action, first, second);
+	}
+
 	/** Define a jogada. */
 	virtual void choose_play(const PubAction *last_action, /**< [in] a última ação executada */
 							 int &first, /**< [out] a coordenada da coluna onde se deseja jogar primeiro */
 							 int &second /**< [out] a coordenada da coluna onde se deseja jogar segundo */
-							) = 0;
+							) {
+		throw std::logic_error("PubPlayer::choose_play() not implemented.");
+	}
 };
 } // namespace Pub
 } // namespace Games
@@ -0,0 +1,145 @@
+/** @file PubRules.h
+ *
+ * Regras do jogo Pub para as buscas adversárias (Games::Search).
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_PUB_RULES_H
+#define GAMES_PUB_RULES_H
+
+#include <algorithm>
+#include <vector>
+
+#include "PubState.h"
+#include "Zobrist.hpp"
+
+namespace Games {
+namespace Pub {
+/** Descreve o Pub para Games::Search::AlphaBeta. Uma jogada são as duas
+ * colunas em que o jogador da vez solta suas bolas; como as duas bolas têm a
+ * mesma marca, a ordem não importa e só são geradas jogadas com
+ * <i>first</i> <= <i>second</i> (no máximo 15 por posição). A posição guarda
+ * seu <i>hash</i> de Zobrist, atualizado a cada bola solta ou retirada, para
+ * uso com Games::Search::TranspositionTable. */
+class PubRules {
+public:
+	/** Posição: o tabuleiro e a marca de quem joga. */
+	struct Position {
+		/** Construtor. */
+		Position(const PubState &b, Mark m)
+		: board(b), to_move(m), hash(zobrist().hash(b, EMPTY) ^ (m == BLACK ? zobrist().turn() : 0)) {}
+
+		/** O tabuleiro. */
+		PubState board;
+		/** A marca de quem joga. */
+		Mark to_move;
+		/** O <i>hash</i> de Zobrist do tabuleiro e de quem joga. */
+		uint64_t hash;
+	};
+
+	/** Jogada: as colunas da primeira e da segunda bola. */
+	struct Move {
+		/** Construtor. */
+		Move(unsigned char f = 0, unsigned char s = 0) : first(f), second(s) {}
+		/** Indica se as jogadas são iguais. */
+		bool operator==(const Move &that) const { return first == that.first && second == that.second; }
+
+		/** A coluna da primeira bola. */
+		unsigned char first;
+		/** A coluna da segunda bola. */
+		unsigned char second;
+	};
+
+	/** Tipo da posição. */
+	typedef Position state_type;
+	/** Tipo da jogada. */
+	typedef Move move_type;
+
+	/** Valor de uma partida vencida (a diferença de pontos é somada). */
+	static constexpr double WIN = 1e6;
+
+	/** Acrescenta as jogadas válidas na posição dada, colunas centrais primeiro. */
+	void moves(const Position &position, std::vector<Move> &moves) const {
+		static const unsigned char ORDER[PubState::COLS] = {2, 1, 3, 0, 4};
+
+		const PubState &board = position.board;
+		for(unsigned int i = 0; i < PubState::COLS; ++i) {
+			for(unsigned int j = i; j < PubState::COLS; ++j) {
+				unsigned char first = std::min(ORDER[i], ORDER[j]), second = std::max(ORDER[i], ORDER[j]);
+				unsigned int balls = (first == second ? 2 : 1);
+				if(board.height(first) + balls <= PubState::ROWS && board.height(second) + balls <= PubState::ROWS)
+					moves.push_back(Move(first, second));
+			}
+		}
+	}
+
+	/** Solta as duas bolas de quem joga e passa a vez. */
+	void apply(Position &position, const Move &move) const {
+		toggle(position, move.first);
+		position.board.drop(move.first, position.to_move);
+		toggle(position, move.second);
+		position.board.drop(move.second, position.to_move);
+		position.to_move = opponent_mark(position.to_move);
+		position.hash ^= zobrist().turn();
+	}
+
+	/** Desfaz apply(). */
+	void undo(Position &position, const Move &move) const {
+		position.to_move = opponent_mark(position.to_move);
+		position.hash ^= zobrist().turn();
+		position.board.undo(move.second);
+		toggle(position, move.second);
+		position.board.undo(move.first);
+		toggle(position, move.first);
+	}
+
+	/** Retorna o <i>hash</i> de Zobrist da posição. */
+	uint64_t hash(const Position &position) const { return position.hash; }
+
+	/** Indica se a torre está completa. */
+	bool terminal(const Position &position) const { return position.board.full(); }
+
+	/** Avalia a posição para quem joga. Com a torre completa, o valor é
+	 * decisivo (±WIN mais a diferença de pontos, ou 0 em caso de empate);
+	 * caso contrário, pondera a diferença de pontos já feitos e de sequências
+	 * ainda possíveis (sem bolas do adversário). */
+	double evaluate(const Position &position) const {
+		const PubState &board = position.board;
+		const Mark mark = position.to_move, opponent = opponent_mark(mark);
+
+		const int points = int(count_points(board.board(mark))) - int(count_points(board.board(opponent)));
+		if(board.full()) {
+			if(points > 0) return WIN + points;
+			if(points < 0) return -WIN + points;
+			return 0;
+		}
+
+		const uint64_t empty = board.empty_cells();
+		const int open = int(count_points(board.board(mark) | empty)) - int(count_points(board.board(opponent) | empty));
+		return 16*points + open;
+	}
+
+	/** Retorna as chaves de Zobrist das casas do tabuleiro (casa
+	 * <i>linha*COLS + coluna</i>, marcas WHITE e BLACK). */
+	static const Games::Search::Zobrist &zobrist() {
+		static const Games::Search::Zobrist keys(PubState::ROWS*PubState::COLS, 2);
+		return keys;
+	}
+
+private:
+	// Marca (ou desmarca) no hash a bola de quem joga no topo da coluna.
+	static void toggle(Position &position, unsigned int col) {
+		position.hash ^= zobrist().key(position.board.height(col)*PubState::COLS + col, position.to_move);
+	}
+
+	// Conta as sequências de 4 da máscara dada nas quatro direções.
+	static unsigned int count_points(uint64_t mask) {
+		return PubState::count_lines(mask, 1) + PubState::count_lines(mask, PubState::ROWS) +
+			   PubState::count_lines(mask, PubState::ROWS + 1) + PubState::count_lines(mask, PubState::ROWS + 2);
+	}
+};
+} // namespace Pub
+} // namespace Games
+
+#endif // GAMES_PUB_RULES_H
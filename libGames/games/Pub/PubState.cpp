@@ -10,31 +10,64 @@
 
 namespace Games {
 namespace Pub {
-PubState::PubState() : Games::Grids::Grid2D<Mark>(8, 5, EMPTY), last_action(nullptr) {}
+constexpr unsigned int PubState::ROWS;
+constexpr unsigned int PubState::COLS;
+constexpr uint64_t PubState::FULL;
+
+PubState::PubState() : last_action(nullptr) {
+	bits[WHITE] = bits[BLACK] = 0;
+	for(unsigned int c = 0; c < COLS; ++c) heights[c] = 0;
+}
 
 PubState::PubState(const PubState &state) : 
-	Games::Grids::Grid2D<Mark>(state), 
-	last_action(state.last_action ? state.last_action->clone() : nullptr) {}
+	last_action(state.last_action ? state.last_action->clone() : nullptr) {
+	bits[WHITE] = state.bits[WHITE], bits[BLACK] = state.bits[BLACK];
+	for(unsigned int c = 0; c < COLS; ++c) heights[c] = state.heights[c];
+}
 
 PubState::~PubState() {if(last_action) delete last_action;}
 
 bool PubState::operator< (const PubState &that) const {
 	if(this == &that) return false;
-	return (this->grid < that.grid);
+	if(this->bits[WHITE] != that.bits[WHITE]) return (this->bits[WHITE] < that.bits[WHITE]);
+	return (this->bits[BLACK] < that.bits[BLACK]);
 }
 
 bool PubState::operator== (const PubState &that) const {
 	if(this == &that) return true;
-	return (this->grid == that.grid);
+	return (this->bits[WHITE] == that.bits[WHITE] && this->bits[BLACK] == that.bits[BLACK]);
 }
 
 PubState &PubState::operator= (const PubState &that) {
 	if(this != &that) {
-		this->grid.assign(that.grid.begin(), that.grid.end());
+		bits[WHITE] = that.bits[WHITE], bits[BLACK] = that.bits[BLACK];
+		for(unsigned int c = 0; c < COLS; ++c) heights[c] = that.heights[c];
 		if(this->last_action) delete this->last_action;
 		this->last_action = (that.last_action ? that.last_action->clone() : nullptr);
 	}
 	return *this;
 }
+
+std::ostream &operator <<(std::ostream &os, const PubState &state) {
+	Games::Grids::Coord2D coord;
+	for(coord.row = 0; coord.row < int(PubState::ROWS); ++coord.row) {
+		os << "\n";
+		for(coord.col = 0; coord.col < int(PubState::COLS); ++coord.col) {
+			if(coord.col > 0) os << " ";
+			os << state[coord];
+		}
+	}
+	return os;
+}
+
+void PubState::set(const Games::Grids::Coord2D &coord, Mark mark) {
+	const uint64_t mask = bit(coord);
+	bits[WHITE] &= ~mask, bits[BLACK] &= ~mask;
+	if(mark != EMPTY) bits[mark] |= mask;
+
+	// altura: número de casas ocupadas consecutivas a partir do fundo
+	const unsigned int column = ((bits[WHITE] | bits[BLACK]) >> (coord.col*(ROWS + 1))) & 0xFF;
+	heights[coord.col] = __builtin_ctz(~column);
+}
 } // namespace Pub
 } // namespace Games
@@ -10,6 +10,7 @@
 
 #include <ostream>
 #include <stdexcept>
+#include <stdint.h> // uint64_t
 
 #include "State.hpp"
 #include "Game.hpp"
@@ -60,10 +61,40 @@ inline static Mark opponent_mark(const Mark &mark) {
 
 class PubAction;
 /** Define um estado do jogo Pub. O estado é a representação do tabuleiro, uma
- * matriz de oito linhas por cinco colunas em que cada célula pode assumir os
- * um valor estabelecido por Mark. */
-class PubState : public IIA::State<PubState>, public Games::Grids::Grid2D<Mark> {
+ * matriz de oito linhas (a linha 0 é o fundo da torre) por cinco colunas em
+ * que cada célula pode assumir os um valor estabelecido por Mark.
+ *
+ * O tabuleiro é armazenado como <i>bitboard</i>: uma máscara de bits por
+ * jogador, em que a casa (linha, coluna) é o bit <i>coluna*9 + linha</i>, e a
+ * altura de cada coluna. O bit 8 de cada coluna é sempre nulo (sentinela), de
+ * forma que deslocamentos de 1 (vertical), 8 (diagonal descendente), 9
+ * (horizontal) e 10 (diagonal ascendente) nunca "dobram" para outra coluna.
+ * Assim, soltar uma bola é O(1) e contar as sequências de 4 em uma direção
+ * custa três deslocamentos, dois ANDs e um <i>popcount</i>. */
+class PubState : public IIA::State<PubState> {
 public:
+	/** Número de linhas (bolas por buraco). */
+	static constexpr unsigned int ROWS = 8;
+	/** Número de colunas (buracos). */
+	static constexpr unsigned int COLS = 5;
+
+	/** Referência para uma casa do tabuleiro, retornada pelo operador [] não
+	 * constante (não é possível referenciar um bit diretamente). */
+	class Cell {
+	public:
+		/** Construtor. */
+		Cell(PubState &s, const Games::Grids::Coord2D &c) : state(s), coord(c) {}
+		/** Retorna a marca da casa. */
+		operator Mark() const { return static_cast<const PubState &>(state)[coord]; }
+		/** Define a marca da casa. */
+		Cell &operator=(Mark mark) { state.set(coord, mark); return *this; }
+		/** Define a marca da casa como a da casa dada. */
+		Cell &operator=(const Cell &that) { return (*this = Mark(that)); }
+	private:
+		PubState &state;
+		const Games::Grids::Coord2D coord;
+	};
+
 	/** Construtor de um tabuleiro vazio. */
 	PubState();
 	/** Construtor de um tabuleiro como cópia do dado. */
@@ -78,14 +109,99 @@ public:
 	/** Define a instância como cópia do estado dado. */
 	PubState &operator= (const PubState &that);
 
-	/** Converte a grade em string. */
-	friend std::ostream &operator <<(std::ostream &os, const PubState &state) {
-		os << static_cast<Games::Grids::Grid2D<Mark> >(state);
-		return os;
+	/** Converte o tabuleiro em string. */
+	friend std::ostream &operator <<(std::ostream &os, const PubState &state);
+
+	/** Retorna o número de linhas do tabuleiro. */
+	unsigned int row_size() const { return ROWS; }
+	/** Retorna o número de colunas do tabuleiro. */
+	unsigned int col_size() const { return COLS; }
+
+	/** Indica se a coordenada dada está dentro do tabuleiro. */
+	bool valid(const Games::Grids::Coord2D &coord) const {
+		return (0 <= coord.row && coord.row < int(ROWS) && 0 <= coord.col && coord.col < int(COLS));
+	}
+
+	/** Retorna uma coordenada fora do tabuleiro. */
+	Games::Grids::Coord2D invalid_coords() const { return Games::Grids::Coord2D(ROWS, COLS); }
+
+	/** Retorna a marca da coordenada dada. */
+	Mark operator[](const Games::Grids::Coord2D &coord) const {
+		const uint64_t mask = bit(check(coord));
+		if(bits[WHITE] & mask) return WHITE;
+		if(bits[BLACK] & mask) return BLACK;
+		return EMPTY;
+	}
+
+	/** Acessa a marca da coordenada dada. */
+	Cell operator[](const Games::Grids::Coord2D &coord) { return Cell(*this, check(coord)); }
+
+	/** Retorna o número de bolas na coluna dada (a linha da próxima bola). */
+	unsigned int height(unsigned int col) const { return heights[col]; }
+
+	/** Indica se o tabuleiro está completo. */
+	bool full() const { return (bits[WHITE] | bits[BLACK]) == FULL; }
+
+	/** Retorna a máscara de bits das casas com a marca dada. */
+	uint64_t board(Mark mark) const { return bits[mark]; }
+
+	/** Solta uma bola com a marca dada na coluna dada. */
+	void drop(unsigned int col, Mark mark) {
+		if(col >= COLS || heights[col] >= ROWS || mark == EMPTY)
+			throw std::invalid_argument("Invalid column to mark.");
+		bits[mark] |= bit(heights[col]++, col);
+	}
+
+	/** Retira a última bola da coluna dada (desfaz drop()). */
+	void undo(unsigned int col) {
+		if(col >= COLS || heights[col] == 0)
+			throw std::invalid_argument("Invalid column to unmark.");
+		const uint64_t mask = ~bit(--heights[col], col);
+		bits[WHITE] &= mask, bits[BLACK] &= mask;
+	}
+
+	/** Retorna o número de sequências de 4 bolas com a marca dada na direção
+	 * definida pelo deslocamento dado (1: vertical, 8 e 10: diagonais,
+	 * 9: horizontal). */
+	unsigned int count_lines(Mark mark, unsigned int shift) const {
+		return count_lines(bits[mark], shift);
+	}
+
+	/** Retorna o número de sequências de 4 casas da máscara dada na direção
+	 * definida pelo deslocamento dado. */
+	static unsigned int count_lines(uint64_t mask, unsigned int shift) {
+		uint64_t pairs = mask & (mask >> shift);
+		return __builtin_popcountll(pairs & (pairs >> (2*shift)));
 	}
 
+	/** Retorna a máscara de bits das casas vazias. */
+	uint64_t empty_cells() const { return FULL & ~(bits[WHITE] | bits[BLACK]); }
+
 	/** Indica a última ação executada no estado. */
 	PubAction *last_action;
+
+private:
+	// Máscara do tabuleiro completo.
+	static constexpr uint64_t FULL = 0xFF7FBFDFEFFULL; // 5 colunas de 8 bits, a cada 9 bits
+	
+	// Retorna a máscara da casa dada.
+	static uint64_t bit(unsigned int row, unsigned int col) { return uint64_t(1) << (col*(ROWS + 1) + row); }
+	static uint64_t bit(const Games::Grids::Coord2D &coord) { return bit(coord.row, coord.col); }
+
+	// Verifica se a coordenada é válida.
+	const Games::Grids::Coord2D &check(const Games::Grids::Coord2D &coord) const {
+		if(!valid(coord))
+			throw std::invalid_argument("Invalid coord " + IIA::Utils::String::to_string(coord) + ".");
+		return coord;
+	}
+
+	// Define a marca de uma casa qualquer (não necessariamente no topo da
+	// coluna), recalculando a altura da coluna.
+	void set(const Games::Grids::Coord2D &coord, Mark mark);
+
+	// Attributes
+	uint64_t bits[2]; // WHITE, BLACK
+	unsigned char heights[COLS];
 };
 } // namespace Pub
 } // namespace Games
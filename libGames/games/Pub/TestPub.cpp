@@ -8,6 +8,8 @@
 #include <assert.h>
 
 #include "Utils.h"
+#include "PubAlphaBetaPlayer.h"
+#include "PubMonteCarloPlayer.h"
 #include "PubRandomPlayer.h"
 
 using namespace Games::Pub;
@@ -71,6 +73,110 @@ void test_State() {
 	assert(sstr.str() == str);
 }
 
+void test_drop_undo() {
+	PubState state;
+	assert(!state.full());
+	assert(state.board(WHITE) == 0 && state.board(BLACK) == 0);
+
+	state.drop(2, WHITE), state.drop(2, BLACK);
+	assert(state.height(2) == 2 && state.height(0) == 0);
+	assert(state[Games::Grids::Coord2D(0, 2)] == WHITE);
+	assert(state[Games::Grids::Coord2D(1, 2)] == BLACK);
+
+	state.undo(2);
+	assert(state.height(2) == 1);
+	assert(state[Games::Grids::Coord2D(1, 2)] == EMPTY);
+
+	try {
+		state.drop(state.col_size(), WHITE);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+	try {
+		state.undo(0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	for(unsigned int c = 0; c < state.col_size(); ++c)
+		while(state.height(c) < state.row_size()) state.drop(c, BLACK);
+	assert(state.full());
+	try {
+		state.drop(0, WHITE);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	// alteração direta de uma casa atualiza a altura da coluna
+	state[Games::Grids::Coord2D(3, 1)] = EMPTY;
+	assert(state.height(1) == 3 && !state.full());
+}
+
+// Contagem de sequências de 4 casa a casa, para comparação com o bitboard.
+unsigned int count_lines(const PubState &state, Mark mark, int d_row, int d_col) {
+	unsigned int points = 0;
+	Games::Grids::Coord2D coord;
+	for(coord.row = 0; coord.row < state.row_size(); ++coord.row) {
+		for(coord.col = 0; coord.col < state.col_size(); ++coord.col) {
+			int i = 0;
+			for(Games::Grids::Coord2D c = coord; i < 4; ++i, c.row += d_row, c.col += d_col)
+				if(!state.valid(c) || state[c] != mark) break;
+			if(i == 4) ++points;
+		}
+	}
+	return points;
+}
+
+void test_count_points() {
+	IIA::Utils::Random::Generator generator(2026);
+	for(int j = 0; j < 200; ++j) {
+		PubState state;
+		while(!state.full()) {
+			unsigned int col = generator.get_random_int(state.col_size() - 1);
+			if(state.height(col) < state.row_size())
+				state.drop(col, generator.get_random_int(1) ? WHITE : BLACK);
+		}
+
+		for(Mark mark : {WHITE, BLACK}) {
+			assert(PubMatch::count_in_row(state, mark) == count_lines(state, mark, 0, 1));
+			assert(PubMatch::count_in_col(state, mark) == count_lines(state, mark, 1, 0));
+			assert(PubMatch::count_in_diag(state, mark) == count_lines(state, mark, 1, 1) + count_lines(state, mark, -1, 1));
+		}
+	}
+}
+
+void test_PubRules_hash() {
+	PubRules rules;
+	PubState state;
+	PubRules::Position position(state, WHITE);
+	const uint64_t initial = position.hash;
+	assert(rules.hash(position) == initial);
+	assert(PubRules::Position(state, BLACK).hash != initial);
+
+	// o hash incremental é sempre igual ao recalculado
+	IIA::Utils::Random::Generator generator(2026);
+	std::vector<PubRules::Move> played, moves;
+	for(;;) {
+		moves.clear();
+		rules.moves(position, moves);
+		if(moves.empty()) break;
+
+		PubRules::Move move = moves[generator.get_random_int(moves.size() - 1)];
+		rules.apply(position, move);
+		played.push_back(move);
+		assert(position.hash == PubRules::Position(position.board, position.to_move).hash);
+	}
+
+	// transposição: mesma posição por caminhos diferentes
+	PubRules::Position a(state, WHITE), b(state, WHITE);
+	rules.apply(a, PubRules::Move(0, 1)), rules.apply(a, PubRules::Move(3, 3)), rules.apply(a, PubRules::Move(2, 2));
+	rules.apply(b, PubRules::Move(2, 2)), rules.apply(b, PubRules::Move(3, 3)), rules.apply(b, PubRules::Move(0, 1));
+	assert(a.hash == b.hash);
+
+	while(!played.empty()) {
+		rules.undo(position, played.back());
+		played.pop_back();
+	}
+	assert(position.hash == initial && position.to_move == WHITE);
+}
+
 void test_action_constructor(const unsigned int first, const unsigned int second, Mark mark, double cost) {
 	PubAction action(first, second, mark, cost);
 	assert(action.first == first && action.second == second && action.mark == mark && action.cost == cost);
@@ -145,6 +251,62 @@ void test_PubRandomPlayer() {
 	delete action;
 }
 
+void test_PubAlphaBetaPlayer() {
+	PubAlphaBetaPlayer abp(WHITE, "TestPubAlphaBetaPlayer", MAX_TIME_COST_IN_NANOSECONDS/50);
+	test_PlayerBase(&abp, WHITE, "TestPubAlphaBetaPlayer");
+
+	// completa a sequência na linha 0 (colunas 0 a 3)
+	PubState state;
+	state.drop(0, WHITE), state.drop(1, WHITE), state.drop(2, WHITE);
+	state.drop(4, BLACK), state.drop(4, BLACK);
+	IIA::Action<PubState> *action = abp.decide_action(state);
+	assert(action && action->cost > 0 && action->cost <= MAX_TIME_COST_IN_NANOSECONDS);
+	PubAction *pub_action = static_cast<PubAction *>(action);
+	assert(pub_action->first == 3 || pub_action->second == 3);
+	delete action;
+
+	// vence o jogador aleatório
+	PubRandomPlayer rp(BLACK, "PubRandomPlayer");
+	std::deque<PubPlayer *> players;
+	players.push_back(&abp), players.push_back(&rp);
+	IIA::Utils::Random::thread_generator().set_seed(2026, 0);
+	for(int i = 0; i < 2; ++i) {
+		PubMatch match(players);
+		match.play();
+		assert(match.get_result(&abp) == Games::VICTORY);
+		players.push_back(players.front()), players.pop_front();
+	}
+}
+
+void test_PubMonteCarloPlayer() {
+	PubMonteCarloPlayer mcp(WHITE, "TestPubMonteCarloPlayer", MAX_TIME_COST_IN_NANOSECONDS/50);
+	test_PlayerBase(&mcp, WHITE, "TestPubMonteCarloPlayer");
+
+	// o custo inclui o tempo de todas as threads da busca
+	const double budget = MAX_TIME_COST_IN_NANOSECONDS/50;
+	for(unsigned int workers : {1, 4}) {
+		PubMonteCarloPlayer player(WHITE, "TestPubMonteCarloPlayer", budget, workers);
+		IIA::Action<PubState> *action = player.decide_action(PubState());
+		assert(action->cost >= budget && action->cost <= MAX_TIME_COST_IN_NANOSECONDS);
+		delete action;
+	}
+
+	// vence o jogador aleatório, com uma ou mais threads
+	PubMonteCarloPlayer mcp2(WHITE, "TestPubMonteCarloPlayer2", MAX_TIME_COST_IN_NANOSECONDS/100, 2);
+	PubRandomPlayer rp(BLACK, "PubRandomPlayer");
+	IIA::Utils::Random::thread_generator().set_seed(2026, 0);
+	for(PubPlayer *player : {static_cast<PubPlayer *>(&mcp), static_cast<PubPlayer *>(&mcp2)}) {
+		std::deque<PubPlayer *> players;
+		players.push_back(player), players.push_back(&rp);
+		for(int i = 0; i < 2; ++i) {
+			PubMatch match(players);
+			match.play();
+			assert(match.get_result(player) == Games::VICTORY);
+			players.push_back(players.front()), players.pop_front();
+		}
+	}
+}
+
 void test_Match() {	
                    	PubRandomPlayer rp(WHITE, "PubRandomPlayer");
                    	PubRandomPlayer rp2(rp.mark, "PubRandomPlayer2");
@@ -228,8 +390,13 @@ void test_Match() {
 int main(int argc, char **argv) {
 	test_Mark();
 	test_State();
+	test_drop_undo();
+	test_count_points();
+	test_PubRules_hash();
 	test_Action();
 	test_PubRandomPlayer();
+	test_PubAlphaBetaPlayer();
+	test_PubMonteCarloPlayer();
 	test_Match();
 	
 	return 0;
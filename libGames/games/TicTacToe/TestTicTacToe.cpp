@@ -8,6 +8,8 @@
 
 #include <assert.h>
 
+#include "TicTacToeAlphaBetaPlayer.h"
+#include "TicTacToeRandomPlayer.h"
 #include "TicTacToeSimplePlayer.h"
 #include "TicTacToeMatch.h"
 
@@ -141,6 +143,21 @@ void test_DummyPlayer() {
 	}
 }
 
+void test_RandomPlayer() {
+	RandomPlayer rp(CROSS, "RandomPlayer");
+	test_PlayerBase(&rp, CROSS, "RandomPlayer");
+
+	// sempre marca uma casa vazia, até preencher o tabuleiro
+	IIA::Utils::Random::set_seed(42, 0);
+	TicTacToeState state;
+	for(int i = 0; i < 9; ++i) {
+		TicTacToeAction *action = static_cast<TicTacToeAction *>(rp.decide_action(state));
+		assert(state.valid(action->coord) && state[action->coord] == EMPTY);
+		action->execute(state);
+		delete action;
+	}
+}
+
 void test_SimplePlayer() {
 	SimplePlayer sp(CROSS, "SimplePlayer");
 	test_PlayerBase(&sp, CROSS, "SimplePlayer");
@@ -188,6 +205,43 @@ void test_SimplePlayer() {
 	delete sp_action, delete ssp_action;
 }
 
+void test_AlphaBetaPlayer() {
+	AlphaBetaPlayer abp(CROSS, "AlphaBetaPlayer");
+	test_PlayerBase(&abp, CROSS, "AlphaBetaPlayer");
+
+	// vence, em vez de bloquear
+	Games::Grids::Coord2D coord;
+	TicTacToeState state;
+	coord.row = 0, coord.col = 0, state[coord] = NOUGHT;
+	coord.row = 0, coord.col = 1, state[coord] = NOUGHT;
+	coord.row = 1, coord.col = 0, state[coord] = CROSS;
+	coord.row = 1, coord.col = 1, state[coord] = CROSS;
+
+	IIA::Action<TicTacToeState> *action = abp.decide_action(state);
+	assert(action && action->cost > 0);
+	TicTacToeAction *ttt_action = static_cast<TicTacToeAction *>(action);
+	assert(ttt_action->coord.row == 1 && ttt_action->coord.col == 2);
+	delete action;
+
+	// nunca perde para SimplePlayer, e empata consigo mesmo
+	SimplePlayer sp(NOUGHT, "SimplePlayer");
+	AlphaBetaPlayer abp2(NOUGHT, "AlphaBetaPlayer2");
+	std::deque<TicTacToePlayer *> players;
+	players.push_back(&abp), players.push_back(&sp);
+	for(int i = 0; i < 2; ++i) {
+		TicTacToeMatch match(players);
+		match.play();
+		assert(match.get_result(&abp) != Games::DEFEAT);
+		players.push_back(players.front()), players.pop_front();
+	}
+
+	players.clear();
+	players.push_back(&abp), players.push_back(&abp2);
+	TicTacToeMatch match(players);
+	match.play();
+	assert(match.get_result(&abp) == Games::DRAW);
+}
+
 void test_Match() {
 	SimplePlayer sp(CROSS, "SimplePlayer");
 	SlowSimplePlayer ssp(NOUGHT, "SlowSimplePlayer");
@@ -249,7 +303,9 @@ int main(int argc, char **argv) {
 	test_State();
 	test_Action();
 	test_DummyPlayer();
+	test_RandomPlayer();
 	test_SimplePlayer();
+	test_AlphaBetaPlayer();
 	test_Match();
 
 	return 0;
@@ -42,6 +42,16 @@ public:
 		return "Marcar " + IIA::Utils::String::to_string(mark) + " " + IIA::Utils::String::to_string(coord);
 	}
 
+	/** Codifica a ação em um inteiro (para Games::Log). */
+	uint64_t code() const {
+		return uint64_t(uint8_t(coord.row)) | (uint64_t(uint8_t(coord.col)) << 8) | (uint64_t(mark) << 16);
+	}
+
+	/** Retorna uma nova ação a partir do código dado (@see code()). */
+	static TicTacToeAction *from_code(uint64_t code, double cost) {
+		return new TicTacToeAction(Games::Grids::Coord2D(code & 0xFF, (code >> 8) & 0xFF), Mark((code >> 16) & 0xFF), cost);
+	}
+
 	// Attributes
 	/** A coordenada onde marcar. */
 	Games::Grids::Coord2D coord;
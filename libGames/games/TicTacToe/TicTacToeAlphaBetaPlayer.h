@@ -0,0 +1,51 @@
+/** @file TicTacToeAlphaBetaPlayer.h
+ *
+ * Descreve/define o jogador AlphaBetaPlayer para o \link Games::TicTacToe Jogo-da-Velha\endlink.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_TICTACTOE_ALPHABETAPLAYER_H
+#define GAMES_TICTACTOE_ALPHABETAPLAYER_H
+
+#include "AlphaBetaSearch.hpp"
+#include "TicTacToePlayer.h"
+#include "TicTacToeRules.h"
+#include "TranspositionTable.hpp"
+
+namespace Games {
+namespace TicTacToe {
+/** Jogador AlphaBetaPlayer, que escolhe a jogada com busca alfa-beta
+ * (Games::Search::AlphaBeta). O jogo inteiro é explorado em poucos
+ * milissegundos (as 5478 posições cabem na tabela de transposição), então o
+ * jogador nunca perde. */
+class AlphaBetaPlayer : public TicTacToePlayer {
+public:
+	/** Construtor. */
+	AlphaBetaPlayer(Mark mark, /**< marca do jogador */
+					std::string id = "AlphaBetaPlayer", /**< identifica o jogador */
+					double budget_ns = 1e8 /**< tempo por jogada */
+				   )
+	: TicTacToePlayer(mark, id), budget(budget_ns), table(TABLE_SIZE) {}
+
+	/** Tempo de CPU (em nanossegundos) disponível para cada jogada. */
+	double budget;
+
+protected:
+	/** Escolhe a jogada a ser feita. */
+	Games::Grids::Coord2D choose_play(const TicTacToeState &game) {
+		TicTacToeRules::Position position(game, mark);
+		Games::Search::AlphaBeta<TicTacToeRules> engine(rules, table);
+		return engine.search(position, budget).move;
+	}
+
+private:
+	static constexpr std::size_t TABLE_SIZE = 1 << 14;
+
+	TicTacToeRules rules;
+	Games::Search::TranspositionTable table;
+};
+} // namespace TicTacToe
+} // namespace Games
+
+#endif // GAMES_TICTACTOE_ALPHABETAPLAYER_H
@@ -36,9 +36,7 @@ public:
 		if(moves.size() < 5) return UNKNOWN;
 		if(moves[0]->player != player && moves[1]->player != player) return UNKNOWN;
 
-		TicTacToeState game = result();
-
-		return get_result(game, player->mark);
+		return get_result(result(), player->mark);
 	}
 
 protected:
@@ -31,9 +31,9 @@ public:
 		 * como custo da ação. */
 		timespec start_time, end_time;
 
-		IIA::Utils::Time::get_cpu_time(start_time);
+		IIA::Utils::Time::get_thread_cpu_time(start_time);
 		Games::Grids::Coord2D coord = choose_play(state);
-		IIA::Utils::Time::get_cpu_time(end_time);
+		IIA::Utils::Time::get_thread_cpu_time(end_time);
 
 		timespec diff = IIA::Utils::Time::time_diff(start_time, end_time);
 		double cost_in_ns = IIA::Utils::Time::to_nano(diff);
@@ -0,0 +1,43 @@
+/** @file TicTacToeRandomPlayer.h
+ *
+ * Implementação do jogador RandomPlayer para o Jogo-da-Velha.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_TICTACTOE_RANDOMPLAYER_H
+#define GAMES_TICTACTOE_RANDOMPLAYER_H
+
+#include "RandomUtils.h"
+#include "TicTacToePlayer.h"
+
+namespace Games {
+namespace TicTacToe {
+/** Classe de jogador para o Jogo-da-Velha. Marca uma casa vazia escolhida
+ * aleatoriamente (com o gerador da <i>thread</i>, IIA::Utils::Random). */
+class RandomPlayer : public TicTacToePlayer {
+public:
+	/** Construtor. */
+	RandomPlayer(Mark mark, /**< marca do jogador */
+				 std::string id = "RandomPlayer" /**< identifica o jogador */
+				 )
+	: TicTacToePlayer(mark, id) {}
+
+protected:
+	/** Escolhe a jogada a ser feita. */
+	Games::Grids::Coord2D choose_play(const TicTacToeState &game) {
+		Games::Grids::Coord2D empty[9], coord;
+		int num_empty = 0;
+		for(coord.row = 0; coord.row < 3; ++coord.row)
+			for(coord.col = 0; coord.col < 3; ++coord.col)
+				if(game[coord] == EMPTY) empty[num_empty++] = coord;
+
+		if(num_empty == 0)
+			throw std::invalid_argument("RandomPlayer could not choose a play.");
+		return empty[IIA::Utils::Random::get_random_int(num_empty - 1)];
+	}
+};
+} // namespace TicTacToe
+} // namespace Games
+
+#endif // GAMES_TICTACTOE_RANDOMPLAYER_H
@@ -0,0 +1,118 @@
+/** @file TicTacToeRules.h
+ *
+ * Regras do \link Games::TicTacToe Jogo-da-Velha\endlink para as buscas
+ * adversárias (Games::Search).
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_TICTACTOE_RULES_H
+#define GAMES_TICTACTOE_RULES_H
+
+#include <vector>
+
+#include "TicTacToeState.h"
+#include "Zobrist.hpp"
+
+namespace Games {
+namespace TicTacToe {
+/** Descreve o \link TicTacToe Jogo-da-Velha\endlink para
+ * Games::Search::AlphaBeta. Uma jogada é a coordenada a marcar. A posição
+ * guarda seu <i>hash</i> de Zobrist, atualizado a cada jogada. */
+class TicTacToeRules {
+public:
+	/** Posição: o tabuleiro e a marca de quem joga. */
+	struct Position {
+		/** Construtor. */
+		Position(const TicTacToeState &b, Mark m)
+		: board(b), to_move(m), hash(zobrist().hash(b, EMPTY) ^ (m == NOUGHT ? zobrist().turn() : 0)) {}
+
+		/** O tabuleiro. */
+		TicTacToeState board;
+		/** A marca de quem joga. */
+		Mark to_move;
+		/** O <i>hash</i> de Zobrist do tabuleiro e de quem joga. */
+		uint64_t hash;
+	};
+
+	/** Tipo da posição. */
+	typedef Position state_type;
+	/** Tipo da jogada. */
+	typedef Games::Grids::Coord2D move_type;
+
+	/** Acrescenta as jogadas válidas na posição dada: o centro, os cantos e,
+	 * por fim, as bordas. */
+	void moves(const Position &position, std::vector<Games::Grids::Coord2D> &moves) const {
+		static const int ORDER[9][2] = {{1, 1}, {0, 0}, {0, 2}, {2, 0}, {2, 2}, {0, 1}, {1, 0}, {1, 2}, {2, 1}};
+
+		if(winner(position.board) != EMPTY) return;
+		for(const int *cell : ORDER) {
+			Games::Grids::Coord2D coord(cell[0], cell[1]);
+			if(position.board[coord] == EMPTY) moves.push_back(coord);
+		}
+	}
+
+	/** Marca a coordenada e passa a vez. */
+	void apply(Position &position, const Games::Grids::Coord2D &coord) const {
+		position.board[coord] = position.to_move;
+		position.hash ^= zobrist().key(coord.row*3 + coord.col, position.to_move) ^ zobrist().turn();
+		position.to_move = opponent_mark(position.to_move);
+	}
+
+	/** Desfaz apply(). */
+	void undo(Position &position, const Games::Grids::Coord2D &coord) const {
+		position.board[coord] = EMPTY;
+		position.to_move = opponent_mark(position.to_move);
+		position.hash ^= zobrist().key(coord.row*3 + coord.col, position.to_move) ^ zobrist().turn();
+	}
+
+	/** Retorna o <i>hash</i> de Zobrist da posição. */
+	uint64_t hash(const Position &position) const { return position.hash; }
+
+	/** Indica se há vencedor ou se o tabuleiro está completo. */
+	bool terminal(const Position &position) const {
+		if(winner(position.board) != EMPTY) return true;
+
+		Games::Grids::Coord2D coord;
+		for(coord.row = 0; coord.row < 3; ++coord.row)
+			for(coord.col = 0; coord.col < 3; ++coord.col)
+				if(position.board[coord] == EMPTY) return false;
+		return true;
+	}
+
+	/** Avalia a posição para quem joga: 1 (vitória), -1 (derrota) ou 0. */
+	double evaluate(const Position &position) const {
+		Mark mark = winner(position.board);
+		if(mark == EMPTY) return 0;
+		return (mark == position.to_move ? 1 : -1);
+	}
+
+	/** Retorna as chaves de Zobrist das casas do tabuleiro (casa
+	 * <i>linha*3 + coluna</i>). */
+	static const Games::Search::Zobrist &zobrist() {
+		static const Games::Search::Zobrist keys(9, CROSS + 1);
+		return keys;
+	}
+
+	/** Retorna a marca que completou uma linha, coluna ou diagonal (EMPTY, se
+	 * não houver). */
+	static Mark winner(const TicTacToeState &board) {
+		static const int LINES[8][3][2] = {
+			{{0, 0}, {0, 1}, {0, 2}}, {{1, 0}, {1, 1}, {1, 2}}, {{2, 0}, {2, 1}, {2, 2}},
+			{{0, 0}, {1, 0}, {2, 0}}, {{0, 1}, {1, 1}, {2, 1}}, {{0, 2}, {1, 2}, {2, 2}},
+			{{0, 0}, {1, 1}, {2, 2}}, {{0, 2}, {1, 1}, {2, 0}}};
+
+		for(const auto &line : LINES) {
+			Mark mark = board[Games::Grids::Coord2D(line[0][0], line[0][1])];
+			if(mark != EMPTY &&
+			   board[Games::Grids::Coord2D(line[1][0], line[1][1])] == mark &&
+			   board[Games::Grids::Coord2D(line[2][0], line[2][1])] == mark)
+				return mark;
+		}
+		return EMPTY;
+	}
+};
+} // namespace TicTacToe
+} // namespace Games
+
+#endif // GAMES_TICTACTOE_RULES_H
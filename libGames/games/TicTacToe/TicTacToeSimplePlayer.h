@@ -37,8 +37,8 @@ protected:
 		if(game.valid(coord)) return coord;
 		//seria o estado de pior utilidade
 
-		/** Se não houver, tenta uma jogada aleatória. */
-		/** @todo Implementar uma busca minimamente decente...*/
+		/** Se não houver, tenta uma jogada aleatória (para uma busca de
+		 * verdade, veja AlphaBetaPlayer). */
 		/*try {
 			coord = RandomPlayer::getValidRandomCoordinate(state);
 			return coord;
@@ -18,7 +18,15 @@
 
 namespace Games {
 /** Template para uma partida. Cada partida consiste em uma sequência de ações
- * alternadas entre dois jogadores, a serem definidas conforme o estado evolui. */
+ * alternadas entre dois jogadores, a serem definidas conforme o estado evolui.
+ *
+ * O estado resultante das jogadas é mantido pela partida: play() o registra ao
+ * terminar, e result() apenas executa as jogadas acrescentadas desde a última
+ * consulta. Assim, consultas ao resultado (por jogador, estatísticas, etc.)
+ * custam O(1) após o confronto, em vez de refazer toda a partida. Por isso,
+ * uma mesma partida não deve ser consultada por várias <i>threads</i> ao
+ * mesmo tempo, e alterações diretas em moves que não sejam acréscimos ao
+ * final devem ser seguidas de invalidate(). */
 template <class player_t, class action_t, class state_t>
 class Match {
 public:
@@ -51,14 +59,14 @@ public:
 	
 	/** Cria uma partida com os jogadores dados. */
 	Match(const std::deque<player_t *> &p /**< [in] jogadores */
-		 ) : players(p) {
+		 ) : players(p), replayed(0), invalid(nullptr) {
 		if(players.size() < 2)
 			throw std::invalid_argument("Not enough players for match.");
 	}
 	
 	/** Cria uma partida com os jogadores dados. */
 	Match(const std::set<player_t *> &p /**< [in] jogadores */
-		 ) : players(p.begin(), p.end()) {
+		 ) : players(p.begin(), p.end()), replayed(0), invalid(nullptr) {
 		if(players.size() < 2)
 			throw std::invalid_argument("Not enough players for match.");
 	}
@@ -78,6 +86,7 @@ public:
 		std::deque<player_t *> match_players(players);
 		
 		state_t state;
+		const Move *invalid_move = nullptr;
 
 		setup(match_players);
 
@@ -85,7 +94,10 @@ public:
 			Move *move = choose_move(match_players.front(), state);
 			moves.push_back(move);
 
-			if(!allowed(move, state)) break;
+			if(!allowed(move, state)) {
+				invalid_move = move;
+				break;
+			}
 
 			move->execute(state);
 			
@@ -94,6 +106,7 @@ public:
 
 		// cleanup(match_players);
 
+		remember(state, invalid_move);
 		return state;
 	}
 
@@ -101,15 +114,9 @@ public:
 	friend std::ostream &operator <<(std::ostream &os, const Match &match) {
 		os << IIA::Utils::String::join_ptrs(match.moves);
 
-		state_t state;
-		for(int i = 0; i < match.moves.size() - 1; ++i)
-			match.moves[i]->execute(state);
-
-		Move *move = match.moves.back();
-		if(!move || !match.allowed(move, state))
-			os << "\n Invalid move: " << (*move);
-		else
-			move->execute(state);
+		const state_t &state = match.result();
+		if(match.invalid)
+			os << "\n Invalid move: " << *(match.invalid);
 		
 		os << "\n" << state << "\n";
 
@@ -149,26 +156,52 @@ protected:
 	 * jogador e estado dados. */
 	virtual action_t *invalid_action(const player_t *player, const state_t &state) const = 0;
 public:
-	/** Retorna o resultado das ações executadas na ordem em que estão armazenadas. */
-	state_t result() const {
-		state_t state;
-
-		for(Move *move : moves) {
-			if(!allowed(move, state)) break;
-			move->execute(state);
+	/** Retorna o resultado das ações executadas na ordem em que estão
+	 * armazenadas (até a primeira jogada inválida, se houver). Apenas as
+	 * jogadas acrescentadas desde a última consulta são executadas. */
+	const state_t &result() const {
+		if(replayed > moves.size()) invalidate(); // jogadas removidas
+
+		for(; replayed < moves.size(); ++replayed) {
+			if(invalid) continue;
+			if(allowed(moves[replayed], final_state)) moves[replayed]->execute(final_state);
+			else invalid = moves[replayed];
 		}
+		return final_state;
+	}
 
-		return state;
+	/** Descarta o estado guardado, para que a próxima consulta refaça a
+	 * partida. Deve ser chamado após alterar diretamente jogadas já
+	 * consideradas por result() (remover, substituir ou inserir antes do
+	 * final), pois o cache não compara as jogadas. */
+	void invalidate() const {
+		final_state = state_t();
+		replayed = 0, invalid = nullptr;
+	}
+
+	/** Retorna a primeira jogada inválida da partida (ou nullptr, se não
+	 * houver). */
+	const Move *invalid_move() const {
+		result();
+		return invalid;
 	}
 
 	// Attributes
 public:
-	/** A sequência de ações tomadas no confronto. */
+	/** A sequência de ações tomadas no confronto. Jogadas acrescentadas ao
+	 * final são consideradas por result(); outras alterações diretas exigem
+	 * invalidate(). */
 	std::deque<Move *> moves;
 	/** Os jogadores envolvidos na partida. */
 	const std::deque<player_t *> players;
 
 private:
+	// Guarda o estado final de play().
+	void remember(const state_t &state, const Move *invalid_move) {
+		final_state = state;
+		replayed = moves.size(), invalid = invalid_move;
+	}
+
 	// Para o código ficar mais legível
 	// Retorna a jogada.
 	Move *choose_move(player_t *player, state_t &state) const {
@@ -185,6 +218,11 @@ private:
 	inline void next(std::deque<player_t *> &match_players) {
 		match_players.push_back(match_players.front()), match_players.pop_front();
 	}
+
+	// Estado resultante das primeiras jogadas (cache de result()).
+	mutable state_t final_state;
+	mutable std::size_t replayed;	// número de jogadas consideradas
+	mutable const Move *invalid;	// primeira jogada inválida
 };
 } // namespace Games
 
@@ -0,0 +1,428 @@
+/** @file MatchLog.hpp
+ *
+ * Define um registro binário (<i>log</i>) de campeonatos e partidas, para
+ * análise posterior sem executar os jogadores novamente.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_MATCH_LOG_HPP
+#define GAMES_MATCH_LOG_HPP
+
+#include <algorithm> // std::min
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <stdint.h> // uint32_t, uint64_t
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "GameResult.h"
+#include "StringUtils.h"
+
+namespace Games {
+/** Define o escopo do registro binário de partidas.
+ *
+ * O arquivo é uma sequência de registros de 24 bytes (Record), sempre
+ * acrescentados ao final. Cada Writer inicia uma sessão; os jogadores são
+ * identificados por índices locais à sessão, e o Reader os unifica pelo nome.
+ * Uma partida é registrada de uma só vez: o cabeçalho (MATCH), o resultado de
+ * cada jogador (RESULT) e as jogadas (MOVE), com a ação codificada em 64 bits
+ * e o custo medido. Todas as jogadas são registradas, inclusive a primeira
+ * inválida (se houver), cujo índice é guardado no cabeçalho. A ação deve
+ * definir:
+ * @code
+ * uint64_t code() const; 								// codifica a ação
+ * static action_t *from_code(uint64_t code, double cost); // (apenas para Reader::replay)
+ * @endcode
+ *
+ * Exemplo de uso:
+ * @code
+ * Games::Log::Writer log("campeonato.log");
+ * tournament.run();
+ * log.write_tournament(tournament);
+ *
+ * Games::Log::Reader reader("campeonato.log");
+ * for(const Games::Log::Reader::Summary &s : reader.summarize()) ...
+ * PubState final_state = reader.replay<PubState, PubAction>(0);
+ * @endcode */
+namespace Log {
+/** Tipos de registro. */
+enum RecordType {
+	SESSION = 1,	/**< Início de uma sessão (code: MAGIC, player: versão, value: hora). */
+	PLAYER,			/**< Jogador (player: índice, code: tamanho do nome, seguido pelo nome). */
+	TOURNAMENT,		/**< Campeonato (code: semente, player: jogadores, value: rodadas). */
+	MATCH,			/**< Partida (code: identificador, player: número de jogadores, value: índice da primeira jogada inválida, ou -1). */
+	RESULT,			/**< Resultado (player: índice, code: GameResult). */
+	MOVE			/**< Jogada (player: índice, code: ação, value: custo). */
+};
+
+/** Identifica o formato do arquivo. */
+constexpr uint64_t MAGIC = 0x31474f4c41494947ULL; // "GIIALOG1"
+/** Versão do formato. */
+constexpr uint32_t VERSION = 2;
+
+/** Registro do arquivo (24 bytes, na ordem de bytes da máquina). */
+struct Record {
+	/** O tipo do registro (RecordType). */
+	uint8_t type;
+	/** Reservado (zero). */
+	uint8_t reserved[3];
+	/** O índice do jogador (ou um contador, conforme o tipo). */
+	uint32_t player;
+	/** O código (conforme o tipo). */
+	uint64_t code;
+	/** O valor (conforme o tipo). */
+	double value;
+};
+static_assert(sizeof(Record) == 24, "Games::Log::Record must have 24 bytes.");
+
+/** Escreve partidas no final de um arquivo. Pode ser compartilhado entre
+ * <i>threads</i>: cada partida é montada localmente e escrita de uma só vez. */
+class Writer {
+public:
+	/** Abre (ou cria) o arquivo dado e inicia uma nova sessão. */
+	explicit Writer(const std::string &path /**< [in] caminho do arquivo */)
+	: file(std::fopen(path.c_str(), "ab")) {
+		if(!file)
+			throw std::runtime_error("Cannot open log file \"" + path + "\".");
+
+		std::vector<Record> records(1, record(SESSION, VERSION, MAGIC, double(std::time(nullptr))));
+		append(records);
+	}
+
+	/** Fecha o arquivo. */
+	~Writer() { std::fclose(file); }
+
+	Writer(const Writer &) = delete;
+	Writer &operator=(const Writer &) = delete;
+
+	/** Registra a partida dada (já disputada). */
+	template <class match_t>
+	void write(const match_t &match, 	 /**< [in] partida */
+			   uint64_t match_id = 0 /**< [in] identificador da partida */) {
+		std::lock_guard<std::mutex> lock(mutex);
+		std::vector<Record> records;
+		push_back_match(records, match, match_id);
+		append(records);
+	}
+
+	/** Registra o campeonato dado (semente, jogadores e todas as partidas já
+	 * disputadas, identificadas como em Tournament::match_id()). */
+	template <class tournament_t>
+	void write_tournament(const tournament_t &tournament /**< [in] campeonato */) {
+		std::lock_guard<std::mutex> lock(mutex);
+		std::vector<Record> records;
+		records.push_back(record(TOURNAMENT, tournament.players.size(), tournament.seed, tournament.rounds.size()));
+		for(auto player : tournament.players) player_index(records, player);
+
+		for(std::size_t r = 0; r < tournament.rounds.size(); ++r)
+			for(std::size_t d = 0; d < tournament.rounds[r].size(); ++d)
+				for(std::size_t m = 0; m < tournament.rounds[r][d].size(); ++m)
+					push_back_match(records, *(tournament.rounds[r][d][m]), tournament_t::match_id(r, d) | m);
+		append(records);
+	}
+
+	/** Força a escrita dos dados em <i>buffer</i>. */
+	void flush() {
+		std::lock_guard<std::mutex> lock(mutex);
+		std::fflush(file);
+	}
+
+private:
+	static Record record(RecordType type, uint32_t player, uint64_t code, double value) {
+		Record r;
+		std::memset(&r, 0, sizeof(r));
+		r.type = type, r.player = player, r.code = code, r.value = value;
+		return r;
+	}
+
+	// Retorna o índice do jogador, registrando-o se for novo na sessão.
+	template <class player_t>
+	uint32_t player_index(std::vector<Record> &records, const player_t *player) {
+		std::map<const void *, uint32_t>::iterator it = players.find(player);
+		if(it != players.end()) return it->second;
+
+		const uint32_t index = players.size();
+		players[player] = index;
+
+		const std::string name = IIA::Utils::String::to_string(*player);
+		records.push_back(record(PLAYER, index, name.size(), 0));
+		for(std::size_t i = 0; i < name.size(); i += sizeof(Record)) {
+			records.push_back(Record());
+			std::memset(&records.back(), 0, sizeof(Record));
+			name.copy(reinterpret_cast<char *>(&records.back()), sizeof(Record), i);
+		}
+		return index;
+	}
+
+	template <class match_t>
+	void push_back_match(std::vector<Record> &records, const match_t &match, uint64_t match_id) {
+		std::vector<uint32_t> indexes;
+		for(auto player : match.players) indexes.push_back(player_index(records, player));
+
+		const std::size_t header = records.size();
+		records.push_back(record(MATCH, match.players.size(), match_id, -1));
+		for(std::size_t i = 0; i < indexes.size(); ++i)
+			records.push_back(record(RESULT, indexes[i], match.get_result(match.players[i]), 0));
+
+		const auto invalid = match.invalid_move();
+		for(std::size_t m = 0; m < match.moves.size(); ++m) {
+			const auto move = match.moves[m];
+			if(move == invalid && records[header].value < 0) records[header].value = m;
+
+			uint32_t index = 0;
+			for(std::size_t i = 0; i < indexes.size(); ++i)
+				if(match.players[i] == move->player) index = indexes[i];
+			records.push_back(record(MOVE, index, move->action->code(), move->action->cost));
+		}
+	}
+
+	void append(const std::vector<Record> &records) {
+		if(std::fwrite(records.data(), sizeof(Record), records.size(), file) != records.size())
+			throw std::runtime_error("Cannot write to log file.");
+	}
+
+	// Attributes
+	std::FILE *file;
+	std::mutex mutex;
+	std::map<const void *, uint32_t> players; // índices da sessão
+};
+
+/** Lê um arquivo de registro, mapeado em memória (mmap), e indexa suas
+ * partidas. Os registros não são copiados: as jogadas são lidas diretamente
+ * do mapeamento. */
+class Reader {
+public:
+	/** Partida registrada. */
+	struct Match {
+		/** O identificador da partida. */
+		uint64_t id;
+		/** O campeonato da partida (índice em tournaments(), ou -1, se avulsa). */
+		long tournament;
+		/** O índice da primeira jogada inválida (ou -1, se não houver). */
+		long invalid_move;
+		/** Os jogadores (índices em Reader::players()). */
+		std::vector<uint32_t> players;
+		/** O resultado de cada jogador. */
+		std::vector<GameResult> results;
+		/** As jogadas (ação e custo), no mapeamento. O jogador de cada uma
+		 * deve ser obtido com player(). */
+		const Record *moves;
+		/** O número de jogadas. */
+		std::size_t num_moves;
+
+		/** Retorna o jogador (índice em Reader::players()) da i-ésima jogada. */
+		uint32_t player(std::size_t i) const {
+			const uint32_t local = moves[i].player;
+			for(std::size_t p = 0; p < locals.size(); ++p)
+				if(locals[p] == local) return players[p];
+			throw std::invalid_argument("Invalid log file (move by unknown player).");
+		}
+
+		/** Os índices dos jogadores na sessão em que a partida foi escrita. */
+		std::vector<uint32_t> locals;
+	};
+
+	/** Campeonato registrado. */
+	struct Tournament {
+		/** A semente. */
+		uint64_t seed;
+		/** Número de jogadores. */
+		uint32_t num_players;
+		/** Número de rodadas. */
+		uint32_t num_rounds;
+	};
+
+	/** Estatísticas acumuladas de um jogador. */
+	struct Summary {
+		unsigned int num_matches;	/**< Número de partidas. */
+		unsigned int num_victories; /**< Número de vitórias. */
+		unsigned int num_defeats;	/**< Número de derrotas. */
+		unsigned int num_draws;		/**< Número de empates. */
+		unsigned int num_moves;		/**< Número de jogadas. */
+		double total_cost;			/**< Custo total das jogadas. */
+	};
+
+	/** Mapeia e indexa o arquivo dado. Um registro incompleto no final (uma
+	 * escrita interrompida) é ignorado. */
+	explicit Reader(const std::string &path /**< [in] caminho do arquivo */)
+	: data(nullptr), length(0) {
+		int fd = open(path.c_str(), O_RDONLY);
+		if(fd < 0)
+			throw std::runtime_error("Cannot open log file \"" + path + "\".");
+
+		struct stat info;
+		if(fstat(fd, &info) == 0) length = info.st_size;
+		if(length >= sizeof(Record)) {
+			data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(data == MAP_FAILED) data = nullptr;
+		}
+		close(fd);
+		if(!data)
+			throw std::invalid_argument("Invalid log file \"" + path + "\".");
+
+		try {
+			index();
+		} catch(...) {
+			munmap(data, length);
+			throw;
+		}
+	}
+
+	/** Libera o mapeamento. */
+	~Reader() { munmap(data, length); }
+
+	Reader(const Reader &) = delete;
+	Reader &operator=(const Reader &) = delete;
+
+	/** Retorna o número de registros. */
+	std::size_t size() const { return length / sizeof(Record); }
+
+	/** Retorna o nome de cada jogador (todas as sessões). */
+	const std::vector<std::string> &players() const { return names; }
+
+	/** Retorna as partidas, na ordem em que foram registradas. */
+	const std::vector<Match> &matches() const { return match_list; }
+
+	/** Retorna os campeonatos, na ordem em que foram registrados. */
+	const std::vector<Tournament> &tournaments() const { return tournament_list; }
+
+	/** Refaz a partida dada, executando suas jogadas (decodificadas com
+	 * action_t::from_code()) a partir do estado inicial, até a primeira
+	 * inválida. O estado final é o mesmo de Match::result(), pois as regras
+	 * da partida (Match::allowed()) já foram aplicadas ao registrá-la. */
+	template <class state_t, class action_t>
+	state_t replay(std::size_t match /**< [in] índice da partida */) const {
+		const Match &m = match_list.at(match);
+		const std::size_t valid = (m.invalid_move < 0 ? m.num_moves : std::min<std::size_t>(m.invalid_move, m.num_moves));
+
+		state_t state;
+		for(std::size_t i = 0; i < valid; ++i) {
+			action_t *action = action_t::from_code(m.moves[i].code, m.moves[i].value);
+			try {
+				action->execute(state);
+			} catch(const std::invalid_argument &e) {
+				delete action;
+				throw std::invalid_argument("Invalid log file (move cannot be replayed).");
+			}
+			delete action;
+		}
+		return state;
+	}
+
+	/** Retorna as estatísticas de cada jogador (na ordem de players()). */
+	std::vector<Summary> summarize() const {
+		Summary empty;
+		std::memset(&empty, 0, sizeof(empty));
+		std::vector<Summary> summaries(names.size(), empty);
+
+		for(const Match &m : match_list) {
+			for(std::size_t i = 0; i < m.players.size(); ++i) {
+				Summary &s = summaries[m.players[i]];
+				++s.num_matches;
+				switch(m.results[i]) {
+				case VICTORY: ++s.num_victories; break;
+				case DEFEAT: ++s.num_defeats; break;
+				case DRAW: ++s.num_draws; break;
+				default: break;
+				}
+			}
+			for(std::size_t i = 0; i < m.num_moves; ++i) {
+				Summary &s = summaries[m.player(i)];
+				++s.num_moves;
+				s.total_cost += m.moves[i].value;
+			}
+		}
+		return summaries;
+	}
+
+private:
+	// Percorre os registros uma vez, convertendo os índices de cada sessão em
+	// índices globais (pelo nome do jogador).
+	void index() {
+		const Record *records = static_cast<const Record *>(data);
+		const std::size_t n = size();
+		if(records[0].type != SESSION || records[0].code != MAGIC)
+			throw std::invalid_argument("Invalid log file (wrong magic number).");
+
+		std::map<std::string, uint32_t> global;
+		std::vector<uint32_t> session; // índice local -> global
+		uint32_t version = VERSION;
+		long tournament = -1;
+
+		std::size_t i = 0;
+		while(i < n) {
+			const Record &r = records[i++];
+			switch(r.type) {
+			case SESSION:
+				if(r.code != MAGIC || r.player > VERSION)
+					throw std::invalid_argument("Invalid log file (unknown session).");
+				session.clear(), version = r.player, tournament = -1;
+				break;
+			case PLAYER: {
+				const std::size_t chunks = (r.code + sizeof(Record) - 1) / sizeof(Record);
+				if(i + chunks > n) return; // nome incompleto
+				std::string name(reinterpret_cast<const char *>(records + i), r.code);
+				i += chunks;
+
+				std::map<std::string, uint32_t>::iterator it = global.find(name);
+				if(it == global.end()) {
+					it = global.insert(std::make_pair(name, uint32_t(names.size()))).first;
+					names.push_back(name);
+				}
+				if(session.size() <= r.player) session.resize(r.player + 1);
+				session[r.player] = it->second;
+				break;
+			}
+			case TOURNAMENT: {
+				Tournament t = {r.code, r.player, uint32_t(r.value)};
+				tournament_list.push_back(t);
+				tournament = tournament_list.size() - 1;
+				break;
+			}
+			case MATCH: {
+				Match m;
+				m.id = r.code, m.tournament = tournament;
+				m.invalid_move = (version < 2 || r.value < 0 ? -1 : long(r.value)); // a versão 1 não registrava
+				for(uint32_t p = 0; p < r.player && i < n && records[i].type == RESULT; ++p, ++i) {
+					m.locals.push_back(records[i].player);
+					m.players.push_back(global_index(session, records[i].player));
+					m.results.push_back(GameResult(records[i].code));
+				}
+				m.moves = records + i, m.num_moves = 0;
+				while(i < n && records[i].type == MOVE) ++m.num_moves, ++i;
+				match_list.push_back(m);
+				break;
+			}
+			default:
+				throw std::invalid_argument("Invalid log file (unknown record type).");
+			}
+		}
+	}
+
+	static uint32_t global_index(const std::vector<uint32_t> &session, uint32_t local) {
+		if(local >= session.size())
+			throw std::invalid_argument("Invalid log file (unknown player).");
+		return session[local];
+	}
+
+	// Attributes
+	void *data;
+	std::size_t length;
+	std::vector<std::string> names;
+	std::vector<Match> match_list;
+	std::vector<Tournament> tournament_list;
+};
+} // namespace Log
+} // namespace Games
+
+#endif // GAMES_MATCH_LOG_HPP
@@ -9,9 +9,13 @@
 #ifndef GAMES_TOURNAMENT_HPP
 #define GAMES_TOURNAMENT_HPP
 
+#include <algorithm>
 #include <set>
 
+#include "RandomUtils.h"
+#include "Standings.hpp"
 #include "Statistics.hpp"
+#include "ThreadPool.h"
 
 namespace Games {
 namespace {
@@ -31,18 +35,12 @@ void rotate(std::deque <player_t *> &players) {
 	players.push_back(players.front());
 	players.pop_front();
 }
-/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
 
-} //  namespace
-/** Executa o mínimo número de partidas neessárias para definir o melhor jogador
- * em, no máximo, <i>num_matches</i> partidas. Por exemplo, supondo uma
- * disputa do "melhor de 3 partidas", se um jogador <i>A</i> vencer as duas
- * primeiras partidas, a terceira não será necessária.
- *
- * @param num_matches número máximo de partidas.
- * @param players os jogadores envolvidos na partida */
+// Executa a disputa. Se houver semente, o gerador de números aleatórios da
+// thread é reiniciado com (semente, first_match_id + i) antes da i-ésima partida.
 template <class match_t, class player_t>
-std::deque<match_t *> best_out_of(unsigned int num_matches, const std::deque<player_t *> &players) {
+std::deque<match_t *> play_dispute(unsigned int num_matches, const std::deque<player_t *> &players,
+								   const uint64_t *seed, uint64_t first_match_id) {
 	if(num_matches < 1)
 		throw std::invalid_argument("Must have at least one match per dispute.");
 	if(players.size() < 2)
@@ -59,6 +57,9 @@ std::deque<match_t *> best_out_of(unsigned int num_matches, const std::deque<pla
 	std::deque<player_t *> dispute_players(players);
 
 	do {
+		if(seed)
+			IIA::Utils::Random::thread_generator().set_seed(*seed, first_match_id + matches.size());
+
 		match_t *match = new match_t(dispute_players);
 		matches.push_back(match);
 
@@ -76,18 +77,67 @@ std::deque<match_t *> best_out_of(unsigned int num_matches, const std::deque<pla
 
 	return matches;
 }
+/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
+
+} //  namespace
+/** Executa o mínimo número de partidas neessárias para definir o melhor jogador
+ * em, no máximo, <i>num_matches</i> partidas. Por exemplo, supondo uma
+ * disputa do "melhor de 3 partidas", se um jogador <i>A</i> vencer as duas
+ * primeiras partidas, a terceira não será necessária.
+ *
+ * @param num_matches número máximo de partidas.
+ * @param players os jogadores envolvidos na partida */
+template <class match_t, class player_t>
+std::deque<match_t *> best_out_of(unsigned int num_matches, const std::deque<player_t *> &players) {
+	return play_dispute<match_t, player_t>(num_matches, players, nullptr, 0);
+}
+
+/** Executa a disputa como best_out_of(unsigned int, const std::deque<player_t *> &),
+ * mas reinicia o gerador de números aleatórios da thread corrente
+ * (IIA::Utils::Random::thread_generator()) com o par (<i>seed</i>,
+ * <i>first_match_id</i> + i) antes da i-ésima partida. Jogadores que usam
+ * IIA::Utils::Random têm, então, o mesmo comportamento em qualquer thread e
+ * em qualquer ordem de execução das disputas.
+ *
+ * @param num_matches número máximo de partidas.
+ * @param players os jogadores envolvidos na partida
+ * @param seed a semente (do campeonato).
+ * @param first_match_id o identificador da primeira partida da disputa. */
+template <class match_t, class player_t>
+std::deque<match_t *> best_out_of(unsigned int num_matches, const std::deque<player_t *> &players,
+								  uint64_t seed, uint64_t first_match_id) {
+	return play_dispute<match_t, player_t>(num_matches, players, &seed, first_match_id);
+}
 
-/** Classe abstrata para implementação de um campeonato. */
+/** Classe abstrata para implementação de um campeonato.
+ *
+ * As disputas de uma rodada são independentes entre si (cada jogador participa
+ * de no máximo uma delas), então são executadas concorrentemente por até
+ * <i>num_workers</i> threads. O tempo de uma rodada passa a ser o da disputa
+ * mais demorada, e não a soma de todas. Com um único <i>worker</i>, as
+ * disputas são executadas em sequência na thread que chamou run().
+ *
+ * Antes de cada partida, o gerador de números aleatórios da thread que a
+ * executa é reiniciado a partir de (<i>seed</i>, identificador da partida), e
+ * o sorteio dos jogadores usa a mesma semente. Assim, o campeonato é
+ * reprodutível independentemente do número de <i>workers</i>.
+ *
+ * As estatísticas de cada jogador são acumuladas em <i>standings</i> assim
+ * que cada disputa termina, e podem ser consultadas durante ou após o
+ * campeonato sem percorrer as rodadas. */
 template <class match_t, class player_t>
 class Tournament {
 public:
 	/** Construtor.
 	 *
-	 * @param p os jogadores do campeonato. */
-	Tournament(const std::deque<player_t *> &p)
-	: players(p.begin(), p.end()) {
+	 * @param p os jogadores do campeonato.
+	 * @param workers número máximo de disputas executadas simultaneamente. */
+	Tournament(const std::deque<player_t *> &p, unsigned int workers = 1)
+	: players(p.begin(), p.end()), num_workers(workers), seed(time(nullptr)) {
 		if(players.size() < 2)
 			throw std::invalid_argument("Not enough players for tournament.");
+		if(num_workers < 1)
+			throw std::invalid_argument("Must have at least one worker for tournament.");
 	}
 
 	/** Destrutor. */
@@ -126,6 +176,13 @@ public:
 		} while(!over(round, tournament_players));
 	}
 
+	/** Retorna o identificador da primeira partida da disputa dada: a rodada
+	 * ocupa os bits a partir do 40, a disputa os bits 20 a 39, e as partidas
+	 * da disputa são numeradas nos 20 bits menos significativos. */
+	static uint64_t match_id(uint64_t round, uint64_t dispute) {
+		return (round << 40) | (dispute << 20);
+	}
+
 protected:
 	/** Define os jogadores que iniciarão o campeonato. */
 	virtual void setup_players(std::deque<player_t *> &tournament_players) {
@@ -133,17 +190,56 @@ protected:
 	}
 
 	/** Acrescenta uma nova rodada ao final de rounds (definindo todas as
-	 * disputas), e retorna a referência para esta. */
+	 * disputas com push_back_dispute()), e retorna a referência para esta. */
 	virtual std::deque<std::deque<match_t *> > *push_back_new_round(
 		std::deque<player_t *> &tournament_players, /**< [in] jogadores envolvidos */
 		unsigned int num_matches 					/**< [in] número máximo de partidas */
 		) = 0;
 
-	/** Executa todas as partidas da rodada. */
+	/** Agenda, ao final da rodada dada, uma disputa do "melhor de
+	 * <i>num_matches</i>" entre os jogadores dados. A disputa é executada por
+	 * play(), e suas partidas ficam na posição correspondente da rodada. */
+	void push_back_dispute(
+		std::deque<std::deque<match_t *> > *round,  /**< [in] rodada da disputa */
+		const std::deque<player_t *> &match_players, /**< [in] jogadores da disputa */
+		unsigned int num_matches					/**< [in] número máximo de partidas */
+		) {
+		round->push_back(std::deque<match_t *>());
+		scheduled.push_back(Dispute(round->size() - 1, match_players, num_matches));
+	}
+
+	/** Executa todas as disputas agendadas para a rodada, distribuindo-as entre
+	 * até <i>num_workers</i> threads. Cada tarefa escreve apenas na sua
+	 * posição da rodada, então não há sincronização além da espera final. */
 	virtual void play(std::deque<std::deque<match_t *> > *round) {
-		for(std::deque<match_t *> dispute : *round)
-			for(match_t *match : dispute)
-				match->play();
+		std::deque<Dispute> disputes;
+		disputes.swap(scheduled);
+
+		const uint64_t round_id = rounds.size() - 1;
+		const uint64_t tournament_seed = seed;
+
+		unsigned int workers = std::min<std::size_t>(num_workers, disputes.size());
+		if(workers <= 1) {
+			for(const Dispute &dispute : disputes) {
+				(*round)[dispute.index] = best_out_of<match_t, player_t>(dispute.num_matches, dispute.players,
+																		 tournament_seed, match_id(round_id, dispute.index));
+				standings.add((*round)[dispute.index]);
+			}
+			return;
+		}
+
+		IIA::Utils::ThreadPool pool(workers);
+		Statistics::Standings<match_t, player_t> *tournament_standings = &standings;
+		for(const Dispute &dispute : disputes) {
+			std::deque<match_t *> *matches = &((*round)[dispute.index]);
+			uint64_t first_match = match_id(round_id, dispute.index);
+			pool.submit([matches, dispute, tournament_seed, first_match, tournament_standings]() {
+				*matches = best_out_of<match_t, player_t>(dispute.num_matches, dispute.players,
+														  tournament_seed, first_match);
+				tournament_standings->add(*matches);
+			});
+		}
+		pool.wait();
 	}
 
 	/** Atualiza o conjunto de jogadores em função da rodada disputada. */
@@ -159,7 +255,19 @@ protected:
 		) = 0;
 
 private:
+	// Disputa agendada por push_back_dispute() e ainda não executada.
+	struct Dispute {
+		Dispute(std::size_t i, const std::deque<player_t *> &p, unsigned int n)
+		: index(i), players(p), num_matches(n) {}
+
+		std::size_t index;				 // posição na rodada
+		std::deque<player_t *> players;
+		unsigned int num_matches;
+	};
+
 	void clear_rounds() {
+		scheduled.clear();
+		standings.clear();
 		for(std::deque<std::deque<match_t *> > round : rounds) {
 			for(std::deque<match_t *> dispute : round)
 				IIA::Utils::empty(dispute);
@@ -177,6 +285,19 @@ public:
 	 * composta por um conjunto de disputas, que são um conjunto de partidas
 	 * entre jogadores. */
 	std::deque<std::deque<std::deque<match_t *> > >rounds;
+
+	/** Número máximo de disputas executadas simultaneamente em uma rodada. */
+	unsigned int num_workers;
+
+	/** Semente do campeonato (por padrão, o relógio do sistema na criação). */
+	uint64_t seed;
+
+	/** Estatísticas acumuladas de cada jogador em todas as partidas já
+	 * disputadas. */
+	Statistics::Standings<match_t, player_t> standings;
+
+private:
+	std::deque<Dispute> scheduled;
 };
 } // namespace Games
 #endif /* GAMES_TOURNAMENT_HPP */
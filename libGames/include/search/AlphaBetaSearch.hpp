@@ -0,0 +1,290 @@
+/** @file AlphaBetaSearch.hpp
+ *
+ * Define uma busca adversária (minimax com poda alfa-beta) genérica para jogos
+ * de dois jogadores com informação perfeita.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_SEARCH_ALPHA_BETA_HPP
+#define GAMES_SEARCH_ALPHA_BETA_HPP
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "TimeUtils.h"
+#include "TranspositionTable.hpp"
+
+namespace Games {
+/** Define o escopo de algoritmos de busca adversária. */
+namespace Search {
+/** Busca minimax (na forma <i>negamax</i>) com poda alfa-beta, aprofundamento
+ * iterativo, ordenação de jogadas e limite de tempo. Mais informações na
+ * <a href="http://en.wikipedia.org/wiki/Alpha-beta_pruning">Wikipedia</a>.
+ *
+ * O jogo é descrito pelas regras (<i>rules_t</i>), que devem definir:
+ * @code
+ * typedef ... state_type; // posição (inclui quem joga)
+ * typedef ... move_type;  // jogada (construtor padrão e operador ==)
+ *
+ * void moves(const state_type &, std::vector<move_type> &) const; // jogadas válidas
+ * void apply(state_type &, const move_type &) const; // executa a jogada
+ * void undo(state_type &, const move_type &) const;  // desfaz a jogada
+ * bool terminal(const state_type &) const;           // fim de jogo?
+ * double evaluate(const state_type &) const; // utilidade para quem joga
+ * @endcode
+ * A avaliação é sempre do ponto de vista do jogador da vez; as jogadas são
+ * executadas e desfeitas na mesma posição, sem cópias. Para usar uma
+ * TranspositionTable, as regras também devem definir
+ * <code>uint64_t hash(const state_type &) const</code> (por exemplo, um
+ * <i>hash</i> de Zobrist atualizado em apply/undo), e a geração de jogadas
+ * deve ser determinística, pois a tabela guarda o índice da melhor jogada.
+ *
+ * Cada iteração aprofunda um nível, e as jogadas da raiz são reordenadas pelo
+ * valor obtido na iteração anterior. Nos demais níveis, a melhor jogada da
+ * tabela de transposição (se houver) e a última jogada que causou uma poda
+ * naquele nível (<i>killer move</i>) são tentadas primeiro. O
+ * tempo é o de CPU da <i>thread</i> (o mesmo usado como custo das jogadas), e
+ * uma iteração interrompida é descartada.
+ *
+ * Exemplo de uso:
+ * @code
+ * TicTacToeRules rules;
+ * TicTacToeRules::state_type position(game, CROSS);
+ * Games::Search::AlphaBeta<TicTacToeRules> engine(rules);
+ * Coord2D coord = engine.search(position, 1e8).move;
+ * @endcode */
+template <class rules_t>
+class AlphaBeta {
+public:
+	/** Tipo da posição. */
+	typedef typename rules_t::state_type state_t;
+	/** Tipo da jogada. */
+	typedef typename rules_t::move_type move_t;
+
+	/** Resultado de uma busca. */
+	struct Result {
+		/** A melhor jogada encontrada. */
+		move_t move;
+		/** O valor da jogada para quem joga. */
+		double value;
+		/** A profundidade da última iteração completa. */
+		unsigned int depth;
+		/** Número de posições visitadas (todas as iterações). */
+		std::size_t nodes;
+		/** Indica se a árvore foi explorada até o fim (valor exato). */
+		bool complete;
+	};
+
+	/** Construtor. */
+	AlphaBeta(const rules_t &r /**< [in] regras do jogo */) : rules(r), table(nullptr) {}
+
+	/** Construtor. A tabela pode ser compartilhada entre buscas (e entre
+	 * <i>threads</i>), e é consultada antes de expandir cada posição. */
+	AlphaBeta(const rules_t &r, 	   /**< [in] regras do jogo */
+			  TranspositionTable &t /**< [in] tabela de transposição */)
+	: rules(r), table(&t) {}
+
+	/** Retorna a melhor jogada na posição dada. A posição é alterada durante
+	 * a busca, mas restaurada ao final.
+	 *
+	 * @param state a posição (de quem joga).
+	 * @param budget_ns o tempo máximo de CPU, em nanossegundos.
+	 * @param max_depth a profundidade máxima (em jogadas). */
+	Result search(state_t &state, double budget_ns,
+				  unsigned int max_depth = std::numeric_limits<unsigned int>::max()) {
+		IIA::Utils::Time::get_thread_cpu_time(start_time);
+		budget = budget_ns;
+		nodes = 0;
+		aborted = false;
+		killers.clear();
+
+		std::vector<move_t> moves;
+		rules.moves(state, moves);
+		if(moves.empty())
+			throw std::invalid_argument("AlphaBeta cannot search a position without moves.");
+
+		Result result;
+		result.move = moves.front();
+		result.value = rules.evaluate(state);
+		result.depth = 0;
+		result.complete = false;
+
+		std::vector<double> values(moves.size());
+		for(unsigned int depth = 1; depth <= max_depth && !result.complete; ++depth) {
+			depth_limited = false;
+
+			double alpha = -INF;
+			std::size_t best = 0;
+			for(std::size_t i = 0; i < moves.size() && !aborted; ++i) {
+				rules.apply(state, moves[i]);
+				values[i] = -negamax(state, depth - 1, 1, -INF, -alpha);
+				rules.undo(state, moves[i]);
+
+				if(values[i] > alpha) alpha = values[i], best = i;
+			}
+			if(aborted) break;
+
+			result.move = moves[best];
+			result.value = alpha;
+			result.depth = depth;
+			result.complete = !depth_limited;
+
+			order(moves, values);
+		}
+
+		result.nodes = nodes;
+		return result;
+	}
+
+private:
+	// Valor da posição para quem joga, no intervalo [alpha, beta].
+	double negamax(state_t &state, unsigned int depth, unsigned int ply, double alpha, double beta) {
+		if((++nodes & 1023) == 0 && out_of_time()) aborted = true;
+		if(aborted) return 0;
+
+		if(rules.terminal(state)) return rules.evaluate(state);
+		if(depth == 0) {
+			depth_limited = true;
+			return rules.evaluate(state);
+		}
+
+		if(buffers.size() <= ply) buffers.resize(ply + 1);
+		std::vector<move_t> &moves = buffers[ply]; // deque: referência estável
+		moves.clear();
+		rules.moves(state, moves);
+		if(moves.empty()) return rules.evaluate(state);
+
+		// ordenação: trocas (0, jogada da tabela) e (first, killer move)
+		const double original_alpha = alpha;
+		std::size_t first = 0, tt_index = 0, killer_index = 0;
+		uint64_t key = 0;
+		if(table) {
+			key = position_hash(rules, state, 0);
+
+			TranspositionTable::Entry entry;
+			if(table->probe(key, entry)) {
+				if(entry.depth >= depth) {
+					double value = entry.value;
+					if(entry.bound == TranspositionTable::EXACT ||
+					   (entry.bound == TranspositionTable::LOWER && value >= beta) ||
+					   (entry.bound == TranspositionTable::UPPER && value <= alpha)) {
+						if(entry.depth != TranspositionTable::COMPLETE) depth_limited = true;
+						return value;
+					}
+				}
+				if(entry.move < moves.size()) {
+					tt_index = entry.move, first = 1;
+					std::swap(moves[0], moves[tt_index]);
+				}
+			}
+		}
+
+		if(killers.size() <= ply) killers.resize(ply + 1, std::make_pair(false, move_t()));
+		if(killers[ply].first) {
+			typename std::vector<move_t>::iterator it = std::find(moves.begin() + first, moves.end(), killers[ply].second);
+			if(it != moves.end()) {
+				killer_index = it - moves.begin();
+				std::iter_swap(moves.begin() + first, it);
+			}
+		}
+
+		// profundidade limitada apenas nesta subárvore?
+		const bool outer_limited = depth_limited;
+		depth_limited = false;
+
+		double best = -INF;
+		std::size_t best_move = 0;
+		for(std::size_t i = 0; i < moves.size(); ++i) {
+			rules.apply(state, moves[i]);
+			double value = -negamax(state, depth - 1, ply + 1, -beta, -alpha);
+			rules.undo(state, moves[i]);
+			if(aborted) return 0;
+
+			if(value > best) best = value, best_move = i;
+			if(value > alpha) alpha = value;
+			if(alpha >= beta) {
+				killers[ply] = std::make_pair(true, moves[i]);
+				break;
+			}
+		}
+
+		const bool limited = depth_limited;
+		depth_limited = outer_limited || limited;
+
+		if(table) {
+			TranspositionTable::Bound bound = TranspositionTable::EXACT;
+			if(best <= original_alpha) bound = TranspositionTable::UPPER;
+			else if(best >= beta) bound = TranspositionTable::LOWER;
+
+			// o índice é o da ordem gerada pelas regras: desfaz as trocas
+			std::size_t index = best_move;
+			if(killer_index) {
+				if(index == first) index = killer_index;
+				else if(index == killer_index) index = first;
+			}
+			if(first) {
+				if(index == 0) index = tt_index;
+				else if(index == tt_index) index = 0;
+			}
+			table->store(key, best, (limited ? depth : unsigned(TranspositionTable::COMPLETE)), bound, index);
+		}
+
+		return best;
+	}
+
+	// Reordena as jogadas (e valores) da raiz em ordem decrescente de valor.
+	static void order(std::vector<move_t> &moves, std::vector<double> &values) {
+		std::vector<std::size_t> index(moves.size());
+		for(std::size_t i = 0; i < index.size(); ++i) index[i] = i;
+		std::stable_sort(index.begin(), index.end(), [&values](std::size_t lhs, std::size_t rhs) {
+			return values[lhs] > values[rhs];
+		});
+
+		std::vector<move_t> sorted_moves;
+		std::vector<double> sorted_values;
+		for(std::size_t i : index)
+			sorted_moves.push_back(moves[i]), sorted_values.push_back(values[i]);
+		moves.swap(sorted_moves), values.swap(sorted_values);
+	}
+
+	// Hash da posição, se as regras o definirem.
+	template <class r_t>
+	static auto position_hash(const r_t &r, const state_t &state, int) -> decltype(r.hash(state)) {
+		return r.hash(state);
+	}
+	template <class r_t>
+	static uint64_t position_hash(const r_t &, const state_t &, long) {
+		throw std::logic_error("AlphaBeta requires rules with hash() to use a TranspositionTable.");
+	}
+
+	// Indica se o tempo disponível se esgotou.
+	bool out_of_time() const {
+		timespec now;
+		IIA::Utils::Time::get_thread_cpu_time(now);
+		return IIA::Utils::Time::to_nano(IIA::Utils::Time::time_diff(start_time, now)) > budget;
+	}
+
+	static constexpr double INF = std::numeric_limits<double>::infinity();
+
+	// Attributes
+	const rules_t &rules;
+	TranspositionTable *table; // opcional
+	std::deque<std::vector<move_t> > buffers;  // jogadas de cada nível
+	std::vector<std::pair<bool, move_t> > killers; // killer move de cada nível
+	timespec start_time;
+	double budget;
+	std::size_t nodes;
+	bool aborted;
+	bool depth_limited; // alguma folha foi avaliada por limite de profundidade
+};
+
+template <class rules_t>
+constexpr double AlphaBeta<rules_t>::INF;
+} // namespace Search
+} // namespace Games
+
+#endif // GAMES_SEARCH_ALPHA_BETA_HPP
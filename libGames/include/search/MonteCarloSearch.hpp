@@ -0,0 +1,350 @@
+/** @file MonteCarloSearch.hpp
+ *
+ * Define uma busca em árvore Monte Carlo (MCTS/UCT) genérica para jogos de
+ * dois jogadores com informação perfeita.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_SEARCH_MONTE_CARLO_HPP
+#define GAMES_SEARCH_MONTE_CARLO_HPP
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <stdint.h> // uint32_t, uint64_t
+#include <vector>
+
+#include "RandomUtils.h"
+#include "ThreadPool.h"
+#include "TimeUtils.h"
+
+namespace Games {
+namespace Search {
+/** Busca em árvore Monte Carlo com UCT (<i>Upper Confidence bounds applied to
+ * Trees</i>). Mais informações na
+ * <a href="http://en.wikipedia.org/wiki/Monte_Carlo_tree_search">Wikipedia</a>.
+ *
+ * O jogo é descrito pelas mesmas regras de AlphaBeta (moves, apply, undo,
+ * terminal e evaluate). A avaliação só é usada em posições finais, e apenas
+ * seu sinal importa (vitória, empate ou derrota de quem joga). As simulações
+ * executam jogadas aleatórias sobre a própria posição, desfazendo-as ao final,
+ * sem cópias nem alocações.
+ *
+ * Com mais de um <i>worker</i>, a busca usa paralelismo na raiz: cada
+ * <i>worker</i> expande sua própria árvore (com seu próprio gerador de números
+ * aleatórios), sem travas, e as visitas às jogadas da raiz são somadas ao
+ * final. A árvore é mantida entre as buscas: advance() a reposiciona na
+ * subárvore da jogada feita, reaproveitando as simulações já realizadas.
+ *
+ * Exemplo de uso:
+ * @code
+ * PubRules rules;
+ * Games::Search::MonteCarlo<PubRules> engine(rules, 4);
+ * PubRules::Move move = engine.search(position, 2.5e8).move;
+ * engine.advance(move); // e, depois, a jogada do adversário
+ * @endcode */
+template <class rules_t>
+class MonteCarlo {
+public:
+	/** Tipo da posição. */
+	typedef typename rules_t::state_type state_t;
+	/** Tipo da jogada. */
+	typedef typename rules_t::move_type move_t;
+
+	/** Resultado de uma busca. */
+	struct Result {
+		/** A jogada mais visitada. */
+		move_t move;
+		/** A taxa de vitórias (entre 0 e 1) da jogada para quem joga. */
+		double value;
+		/** Número de simulações feitas nesta busca (todos os workers). */
+		std::size_t playouts;
+		/** Número de visitas à raiz (inclui as de buscas anteriores). */
+		std::size_t visits;
+		/** Tempo de CPU (em nanossegundos) desta busca, somado entre os
+		 * workers. */
+		double cpu_ns;
+	};
+
+	/** Construtor.
+	 *
+	 * @param r as regras do jogo.
+	 * @param num_workers o número de <i>threads</i> (> 0).
+	 * @param seed a semente dos geradores (o <i>worker</i> i usa o fluxo i).
+	 * @param exploration a constante de exploração do UCT.
+	 * @param max_nodes o número máximo de nós de cada árvore. */
+	MonteCarlo(const rules_t &r, unsigned int num_workers = 1, uint64_t seed = 0x4d435453ULL,
+			   double exploration = std::sqrt(2.0), std::size_t max_nodes = 1 << 22)
+	: rules(r), exploration(exploration), max_nodes(max_nodes) {
+		if(num_workers < 1)
+			throw std::invalid_argument("MonteCarlo must have at least one worker.");
+
+		for(unsigned int i = 0; i < num_workers; ++i)
+			workers.push_back(Worker(seed, i));
+		if(num_workers > 1) pool.reset(new IIA::Utils::ThreadPool(num_workers));
+	}
+
+	/** Retorna a melhor jogada na posição dada. Cada <i>worker</i> usa até
+	 * <i>budget_ns</i> de tempo de CPU (da sua <i>thread</i>) ou
+	 * <i>max_playouts</i> simulações. Se as regras definirem hash() (como em
+	 * AlphaBeta), uma árvore que não corresponda à posição é descartada; caso
+	 * contrário, cabe a quem chama usar advance() ou reset().
+	 *
+	 * @param state a posição (de quem joga), restaurada ao final.
+	 * @param budget_ns o tempo máximo de CPU, em nanossegundos.
+	 * @param max_playouts o número máximo de simulações por <i>worker</i>. */
+	Result search(const state_t &state, double budget_ns,
+				  std::size_t max_playouts = std::numeric_limits<std::size_t>::max()) {
+		std::vector<move_t> moves;
+		rules.moves(state, moves);
+		if(moves.empty())
+			throw std::invalid_argument("MonteCarlo cannot search a position without moves.");
+
+		const uint64_t key = position_hash(rules, state, 0);
+		for(Worker &worker : workers) {
+			if(worker.nodes.empty() || (worker.known && worker.key != key)) worker.nodes.assign(1, Node());
+			worker.key = key, worker.known = true;
+		}
+
+		if(pool) {
+			for(Worker &worker : workers)
+				pool->submit([this, &worker, &state, budget_ns, max_playouts]() {
+					run(worker, state, budget_ns, max_playouts);
+				});
+			pool->wait();
+		} else {
+			run(workers.front(), state, budget_ns, max_playouts);
+		}
+
+		// soma as visitas às jogadas da raiz (geradas na mesma ordem)
+		std::vector<double> visits(moves.size(), 0), wins(moves.size(), 0);
+		Result result;
+		result.playouts = result.visits = 0, result.cpu_ns = 0;
+		for(const Worker &worker : workers) {
+			result.playouts += worker.playouts;
+			result.cpu_ns += worker.cpu_ns;
+			result.visits += worker.nodes.front().visits;
+
+			const Node &root = worker.nodes.front();
+			for(uint32_t i = 0; i < root.num_children && i < moves.size(); ++i) {
+				visits[i] += worker.nodes[root.first_child + i].visits;
+				wins[i] += worker.nodes[root.first_child + i].wins;
+			}
+		}
+
+		std::size_t best = 0;
+		for(std::size_t i = 1; i < moves.size(); ++i)
+			if(visits[i] > visits[best]) best = i;
+		result.move = moves[best];
+		result.value = (visits[best] > 0 ? wins[best]/visits[best] : 0.5);
+		return result;
+	}
+
+	/** Reposiciona as árvores na subárvore da jogada dada (feita na posição da
+	 * última busca, ou após o último advance()). As demais subárvores são
+	 * descartadas; se a jogada ainda não tiver sido expandida, a árvore é
+	 * reiniciada. */
+	void advance(const move_t &move) {
+		for(Worker &worker : workers) worker.advance(move);
+	}
+
+	/** Descarta as árvores. */
+	void reset() {
+		for(Worker &worker : workers) worker.nodes.clear();
+	}
+
+	/** Retorna o número de workers. */
+	unsigned int num_workers() const { return workers.size(); }
+
+	/** Retorna o número total de nós (todos os workers). */
+	std::size_t size() const {
+		std::size_t total = 0;
+		for(const Worker &worker : workers) total += worker.nodes.size();
+		return total;
+	}
+
+private:
+	// Nó da árvore. Os filhos de um nó são contíguos no vetor de nós, na ordem
+	// gerada pelas regras; as vitórias são as de quem fez a jogada do nó.
+	struct Node {
+		Node(const move_t &m = move_t()) : move(m), first_child(0), num_children(0), expanded(false), visits(0), wins(0) {}
+
+		move_t move;
+		uint32_t first_child;
+		uint32_t num_children;
+		bool expanded;
+		uint32_t visits;
+		double wins;
+	};
+
+	// Árvore e estado de cada thread.
+	struct Worker {
+		Worker(uint64_t seed, uint64_t stream) : generator(seed, stream), key(0), known(false), playouts(0), cpu_ns(0) {}
+
+		// Copia a subárvore da jogada dada para o início de um novo vetor.
+		void advance(const move_t &move) {
+			if(nodes.empty() || !nodes.front().expanded) {
+				nodes.clear();
+				return;
+			}
+
+			const Node &root = nodes.front();
+			uint32_t child = root.first_child;
+			while(child < root.first_child + root.num_children && !(nodes[child].move == move)) ++child;
+			if(child == root.first_child + root.num_children) {
+				nodes.clear();
+				return;
+			}
+
+			// cópia em largura: os filhos continuam contíguos
+			std::vector<Node> kept(1, nodes[child]);
+			for(std::size_t i = 0; i < kept.size(); ++i) {
+				const uint32_t first = kept[i].first_child;
+				kept[i].first_child = kept.size();
+				for(uint32_t j = 0; j < kept[i].num_children; ++j)
+					kept.push_back(nodes[first + j]);
+			}
+			nodes.swap(kept);
+			known = false;
+		}
+
+		std::vector<Node> nodes;
+		std::vector<uint32_t> path; // nós da seleção
+		std::vector<move_t> moves;	// jogadas da simulação
+		std::vector<move_t> buffer; // jogadas válidas
+		IIA::Utils::Random::Generator generator;
+		uint64_t key; // hash da raiz
+		bool known;	  // o hash da raiz é conhecido? (não após advance())
+		std::size_t playouts;
+		double cpu_ns; // tempo de CPU da última busca
+	};
+
+	// Executa as simulações de um worker.
+	void run(Worker &worker, const state_t &root, double budget_ns, std::size_t max_playouts) {
+		timespec start_time, now;
+		IIA::Utils::Time::get_thread_cpu_time(start_time);
+
+		state_t state(root);
+		worker.playouts = 0;
+		while(worker.playouts < max_playouts) {
+			if((worker.playouts & 15) == 0) {
+				IIA::Utils::Time::get_thread_cpu_time(now);
+				if(IIA::Utils::Time::to_nano(IIA::Utils::Time::time_diff(start_time, now)) > budget_ns &&
+				   worker.playouts > 0)
+					break;
+			}
+			playout(worker, state);
+			++worker.playouts;
+		}
+
+		IIA::Utils::Time::get_thread_cpu_time(now);
+		worker.cpu_ns = IIA::Utils::Time::to_nano(IIA::Utils::Time::time_diff(start_time, now));
+	}
+
+	// Uma iteração: seleção, expansão, simulação e retropropagação.
+	void playout(Worker &worker, state_t &state) {
+		std::vector<Node> &nodes = worker.nodes;
+		std::vector<uint32_t> &path = worker.path;
+
+		path.assign(1, 0);
+		uint32_t index = 0;
+		while(nodes[index].expanded && nodes[index].num_children > 0) {
+			index = select(nodes, index);
+			rules.apply(state, nodes[index].move);
+			path.push_back(index);
+		}
+
+		if(!nodes[index].expanded && nodes.size() < max_nodes && !rules.terminal(state)) {
+			expand(worker, state, index);
+			if(nodes[index].num_children > 0) {
+				index = nodes[index].first_child; // nenhum filho visitado
+				rules.apply(state, nodes[index].move);
+				path.push_back(index);
+			}
+		}
+
+		// resultado para quem joga na folha; cada nó guarda o de quem o jogou
+		double reward = 1 - simulate(worker, state);
+		for(std::size_t i = path.size(); i-- > 0;) {
+			Node &node = nodes[path[i]];
+			++node.visits;
+			node.wins += reward;
+			reward = 1 - reward;
+			if(i > 0) rules.undo(state, node.move);
+		}
+	}
+
+	// Filho com maior UCT (os não visitados primeiro).
+	uint32_t select(const std::vector<Node> &nodes, uint32_t index) const {
+		const Node &parent = nodes[index];
+		const double log_visits = std::log(double(parent.visits));
+
+		uint32_t best = parent.first_child;
+		double best_value = -1;
+		for(uint32_t i = parent.first_child; i < parent.first_child + parent.num_children; ++i) {
+			const Node &child = nodes[i];
+			if(child.visits == 0) return i;
+
+			const double value = child.wins/child.visits + exploration*std::sqrt(log_visits/child.visits);
+			if(value > best_value) best_value = value, best = i;
+		}
+		return best;
+	}
+
+	// Acrescenta os filhos do nó dado.
+	void expand(Worker &worker, const state_t &state, uint32_t index) {
+		std::vector<move_t> &moves = worker.buffer;
+		moves.clear();
+		rules.moves(state, moves);
+
+		std::vector<Node> &nodes = worker.nodes;
+		nodes[index].expanded = true;
+		nodes[index].first_child = nodes.size();
+		nodes[index].num_children = moves.size();
+		for(const move_t &move : moves) nodes.push_back(Node(move));
+	}
+
+	// Joga aleatoriamente até o fim da partida e desfaz as jogadas. Retorna
+	// 1 (vitória), 0.5 (empate) ou 0 (derrota) para quem joga na posição dada.
+	double simulate(Worker &worker, state_t &state) {
+		std::vector<move_t> &played = worker.moves, &moves = worker.buffer;
+		played.clear();
+		while(!rules.terminal(state)) {
+			moves.clear();
+			rules.moves(state, moves);
+			if(moves.empty()) break;
+
+			const move_t &move = moves[worker.generator.get_random_int(moves.size() - 1)];
+			rules.apply(state, move);
+			played.push_back(move);
+		}
+
+		const double value = rules.evaluate(state);
+		double result = (value > 0 ? 1 : (value < 0 ? 0 : 0.5));
+		if(played.size() % 2) result = 1 - result;
+
+		for(std::size_t i = played.size(); i-- > 0;) rules.undo(state, played[i]);
+		return result;
+	}
+
+	// Hash da posição, se as regras o definirem (0, caso contrário).
+	template <class r_t>
+	static auto position_hash(const r_t &r, const state_t &state, int) -> decltype(r.hash(state)) {
+		return r.hash(state);
+	}
+	template <class r_t>
+	static uint64_t position_hash(const r_t &, const state_t &, long) { return 0; }
+
+	// Attributes
+	const rules_t &rules;
+	const double exploration;
+	const std::size_t max_nodes;
+	std::vector<Worker> workers;
+	std::unique_ptr<IIA::Utils::ThreadPool> pool;
+};
+} // namespace Search
+} // namespace Games
+
+#endif // GAMES_SEARCH_MONTE_CARLO_HPP
@@ -0,0 +1,142 @@
+/** @file TranspositionTable.hpp
+ *
+ * Define uma tabela de transposição para buscas adversárias.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_SEARCH_TRANSPOSITION_TABLE_HPP
+#define GAMES_SEARCH_TRANSPOSITION_TABLE_HPP
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h> // uint64_t
+#include <vector>
+
+namespace Games {
+namespace Search {
+/** Tabela de transposição de tamanho fixo e sem travas (<i>lock-free</i>),
+ * indexada pelo <i>hash</i> (de Zobrist) da posição. Cada entrada guarda a
+ * profundidade da busca, o tipo de limite, o valor e o índice da melhor jogada
+ * (na ordem em que as regras geram as jogadas da posição, o que vale para
+ * qualquer tipo de jogada).
+ *
+ * Cada entrada são duas palavras atômicas: a chave (XOR os dados) e os dados,
+ * como proposto por Hyatt e Mann. Escritas concorrentes podem intercalar as
+ * palavras de entradas diferentes, mas o XOR deixa de bater e a leitura é
+ * descartada, sem travas nem dados corrompidos. O valor é armazenado com
+ * precisão <i>float</i>. Uma entrada é substituída se a posição for outra ou se
+ * a nova busca for ao menos tão profunda quanto a armazenada. */
+class TranspositionTable {
+public:
+	/** Tipo do valor armazenado. */
+	enum Bound {
+		EXACT,	/**< Valor exato. */
+		LOWER,	/**< Limite inferior (houve poda beta). */
+		UPPER	/**< Limite superior (nenhuma jogada superou alfa). */
+	};
+
+	/** Profundidade de uma entrada cuja subárvore foi explorada até o fim
+	 * (o valor vale para qualquer profundidade). */
+	static constexpr unsigned int COMPLETE = 255;
+
+	/** Conteúdo de uma entrada. */
+	struct Entry {
+		/** O valor da posição para quem joga. */
+		double value;
+		/** A profundidade da busca que gerou o valor (ou COMPLETE). */
+		unsigned int depth;
+		/** O tipo do valor. */
+		Bound bound;
+		/** O índice da melhor jogada. */
+		unsigned int move;
+	};
+
+	/** Cria a tabela com (no máximo) o número de entradas dado, arredondado
+	 * para uma potência de 2. */
+	explicit TranspositionTable(std::size_t num_entries /**< [in] número de entradas (> 0) */)
+	: slots(capacity(num_entries)), mask(slots.size() - 1) {}
+
+	/** Retorna o número de entradas. */
+	std::size_t size() const { return slots.size(); }
+
+	/** Apaga todas as entradas. Não deve ser chamada durante uma busca. */
+	void clear() {
+		for(Slot &slot : slots)
+			slot.check.store(0, std::memory_order_relaxed), slot.data.store(0, std::memory_order_relaxed);
+	}
+
+	/** Busca a posição dada. Retorna verdadeiro (e preenche <i>entry</i>)
+	 * se houver uma entrada válida para ela. */
+	bool probe(uint64_t key, Entry &entry) const {
+		const Slot &slot = slots[key & mask];
+		const uint64_t data = slot.data.load(std::memory_order_relaxed);
+		const uint64_t check = slot.check.load(std::memory_order_relaxed);
+		if((check ^ data) != key || data == 0) return false;
+
+		unpack(data, entry);
+		return true;
+	}
+
+	/** Armazena o resultado da busca na posição dada. */
+	void store(uint64_t key, double value, unsigned int depth, Bound bound, unsigned int move) {
+		Slot &slot = slots[key & mask];
+
+		const uint64_t old_data = slot.data.load(std::memory_order_relaxed);
+		const uint64_t old_check = slot.check.load(std::memory_order_relaxed);
+		if((old_check ^ old_data) == key && old_data != 0 && depth < ((old_data >> 32) & 0xFF))
+			return; // mesma posição, busca mais profunda
+
+		const uint64_t data = pack(value, depth, bound, move);
+		slot.check.store(key ^ data, std::memory_order_relaxed);
+		slot.data.store(data, std::memory_order_relaxed);
+	}
+
+private:
+	// Entrada: chave XOR dados, e os dados.
+	struct Slot {
+		Slot() : check(0), data(0) {}
+
+		std::atomic<uint64_t> check;
+		std::atomic<uint64_t> data;
+	};
+
+	// Maior potência de 2 que não excede o número de entradas dado.
+	static std::size_t capacity(std::size_t num_entries) {
+		if(num_entries == 0)
+			throw std::invalid_argument("TranspositionTable must have at least one entry.");
+
+		std::size_t size = 1;
+		while(size <= num_entries/2) size *= 2;
+		return size;
+	}
+
+	// Dados: valor (32 bits), profundidade (8), limite (2), jogada (8) e um bit
+	// sempre 1, para distinguir de uma entrada vazia.
+	static uint64_t pack(double value, unsigned int depth, Bound bound, unsigned int move) {
+		float v = float(value);
+		uint32_t bits;
+		std::memcpy(&bits, &v, sizeof(bits));
+		return uint64_t(bits) | (uint64_t(depth < COMPLETE ? depth : unsigned(COMPLETE)) << 32) |
+			   (uint64_t(bound) << 40) | (uint64_t(move & 0xFF) << 42) | (uint64_t(1) << 50);
+	}
+
+	static void unpack(uint64_t data, Entry &entry) {
+		uint32_t bits = uint32_t(data);
+		float v;
+		std::memcpy(&v, &bits, sizeof(v));
+		entry.value = v;
+		entry.depth = (data >> 32) & 0xFF;
+		entry.bound = Bound((data >> 40) & 0x3);
+		entry.move = (data >> 42) & 0xFF;
+	}
+
+	// Attributes
+	std::vector<Slot> slots;
+	std::size_t mask;
+};
+} // namespace Search
+} // namespace Games
+
+#endif // GAMES_SEARCH_TRANSPOSITION_TABLE_HPP
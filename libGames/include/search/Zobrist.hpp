@@ -0,0 +1,81 @@
+/** @file Zobrist.hpp
+ *
+ * Define o espalhamento de Zobrist para tabuleiros.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_SEARCH_ZOBRIST_HPP
+#define GAMES_SEARCH_ZOBRIST_HPP
+
+#include <stdexcept>
+#include <stdint.h> // uint64_t
+#include <vector>
+
+#include "Game.hpp"
+#include "RandomUtils.h"
+
+namespace Games {
+namespace Search {
+/** <a href="http://en.wikipedia.org/wiki/Zobrist_hashing">Espalhamento de
+ * Zobrist</a>: cada par (casa, marca) tem uma chave aleatória de 64 bits, e
+ * o <i>hash</i> de um tabuleiro é o XOR das chaves das casas ocupadas (mais a
+ * chave de turno, se for a vez do segundo jogador). Marcar ou desmarcar uma
+ * casa atualiza o <i>hash</i> com um único XOR, em O(1):
+ * @code
+ * hash ^= zobrist.key(cell, mark); // marca (ou desmarca) a casa
+ * hash ^= zobrist.turn();          // passa a vez
+ * @endcode
+ * As chaves são geradas deterministicamente a partir da semente dada, então
+ * os valores são os mesmos em qualquer execução. */
+class Zobrist {
+public:
+	/** Cria as chaves para o número de casas e de marcas dados. */
+	Zobrist(unsigned int num_cells, /**< [in] número de casas do tabuleiro */
+			unsigned int num_marks, /**< [in] número de valores de uma casa */
+			uint64_t seed = 0x5a6f6272697374ULL /**< [in] semente das chaves */)
+	: marks(num_marks), keys(num_cells*num_marks) {
+		if(num_cells == 0 || num_marks == 0)
+			throw std::invalid_argument("Zobrist must have at least one cell and one mark.");
+
+		IIA::Utils::Random::Generator generator(seed);
+		for(uint64_t &k : keys) k = generator();
+		turn_key = generator();
+	}
+
+	/** Retorna a chave da marca dada na casa dada. */
+	uint64_t key(unsigned int cell, unsigned int mark) const { return keys[cell*marks + mark]; }
+
+	/** Retorna a chave de turno (XOR a cada jogada). */
+	uint64_t turn() const { return turn_key; }
+
+	/** Calcula o <i>hash</i> completo do tabuleiro dado, que deve oferecer
+	 * row_size(), col_size() e o operador [] (Coord2D), como Grids::Grid2D.
+	 * A casa (linha, coluna) é a de índice <i>linha*col_size() + coluna</i>,
+	 * e casas com a marca <i>empty</i> não contribuem.
+	 *
+	 * @param grid o tabuleiro.
+	 * @param empty a marca de casa vazia. */
+	template <class grid_t, class mark_t>
+	uint64_t hash(const grid_t &grid, mark_t empty) const {
+		uint64_t h = 0;
+		Games::Grids::Coord2D coord;
+		for(coord.row = 0; coord.row < int(grid.row_size()); ++coord.row) {
+			for(coord.col = 0; coord.col < int(grid.col_size()); ++coord.col) {
+				mark_t mark = grid[coord];
+				if(mark != empty) h ^= key(coord.row*grid.col_size() + coord.col, mark);
+			}
+		}
+		return h;
+	}
+
+private:
+	// Attributes
+	unsigned int marks;
+	std::vector<uint64_t> keys;
+	uint64_t turn_key;
+};
+} // namespace Search
+} // namespace Games
+
+#endif // GAMES_SEARCH_ZOBRIST_HPP
@@ -11,6 +11,7 @@
 // #include <set>
 
 #include "PlayerStats.hpp"
+#include "Standings.hpp"
 
 namespace Games {
 namespace Statistics {
@@ -49,19 +50,19 @@ public:
 template <class match_t, class player_t>
 class MultipleMatchStat : public Statistic {
 public:
-	/** Construtor.
+	/** Construtor. As partidas são percorridas uma única vez (Standings).
 	 *
 	 * @param matches o conjunto de partidas de onde se extrai as estatísticas. */
 	MultipleMatchStat(const std::deque<match_t *> &matches) : Statistic(0, 0) {
-		std::set<player_t *> players;
-		for(match_t *match : matches)
-			players.insert(match->players.begin(), match->players.end());
-		for(player_t *player : players) {
-			player_stats.push_back(PlayerMultipleMatchStat<match_t, player_t>(matches, player));
-			PlayerMultipleMatchStat<match_t, player_t> *multimatch = &(player_stats.back());
-			num_moves += multimatch->num_moves;
-			total_cost += multimatch->total_cost;
-		}
+		Standings<match_t, player_t> standings;
+		standings.add(matches);
+		init(standings);
+	}
+
+	/** Construtor a partir das estatísticas já acumuladas. */
+	MultipleMatchStat(const Standings<match_t, player_t> &standings /**< [in] estatísticas acumuladas */)
+	: Statistic(0, 0) {
+		init(standings);
 	}
 
 	/** Converte em string. */
@@ -77,6 +78,15 @@ public:
 	// Attributes	
 	/** Estatísticas para cada jogador da partida. */
 	std::deque<PlayerMultipleMatchStat<match_t, player_t> > player_stats;
+
+private:
+	void init(const Standings<match_t, player_t> &standings) {
+		player_stats = standings.stats();
+		for(const PlayerMultipleMatchStat<match_t, player_t> &multimatch : player_stats) {
+			num_moves += multimatch.num_moves;
+			total_cost += multimatch.total_cost;
+		}
+	}
 };
 } // namespace Statistics
 } // namespace Games
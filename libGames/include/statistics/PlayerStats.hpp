@@ -109,24 +109,37 @@ public:
 		for(match_t *match : matches) {
 			if(IIA::Utils::contains(match->players, player)) {
 				PlayerMatchStat<match_t, player_t> stat(*match, player);
-				this->num_moves += stat.num_moves;
-				this->total_cost += stat.total_cost;
-				this->num_matches++;
-				switch(stat.result) {
-				case VICTORY:
-					this->num_victories++;
-					break;
-				case DEFEAT:
-					this->num_defeats++;
-					break;
-				case DRAW:
-					this->num_draws++;
-					break;
-				default: break;
-				}
+				add(stat.num_moves, stat.total_cost, stat.result);
 			}
 		}
 	}
+
+	/** Construtor de estatísticas sem partidas, a serem acumuladas com add(). */
+	explicit PlayerMultipleMatchStat(player_t *player /**< [in] jogador a que se referem as estatísticas */)
+		: PlayerStat<player_t>(player),
+		  num_matches(0), num_victories(0), num_defeats(0), num_draws(0) {}
+
+	/** Acumula as estatísticas de uma partida do jogador. */
+	void add(unsigned int moves, /**< [in] número de jogadas do jogador na partida */
+			 double cost, 		 /**< [in] custo total das jogadas */
+			 GameResult result 	 /**< [in] resultado da partida para o jogador */
+			) {
+		this->num_moves += moves;
+		this->total_cost += cost;
+		this->num_matches++;
+		switch(result) {
+		case VICTORY:
+			this->num_victories++;
+			break;
+		case DEFEAT:
+			this->num_defeats++;
+			break;
+		case DRAW:
+			this->num_draws++;
+			break;
+		default: break;
+		}
+	}
 	
 	/** Custo médio por partida. */
 	virtual double avg_cost() const {
@@ -0,0 +1,121 @@
+/** @file Standings.hpp
+ *
+ * Declara/define a classificação acumulada dos jogadores.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef GAMES_STATISTICS_STANDINGS_HPP
+#define GAMES_STATISTICS_STANDINGS_HPP
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "PlayerStats.hpp"
+
+namespace Games {
+namespace Statistics {
+/** Acumula as estatísticas de cada jogador (PlayerMultipleMatchStat) à medida
+ * que as partidas terminam. Cada partida é percorrida uma única vez, ao ser
+ * acrescentada, então a classificação pode ser consultada a qualquer momento
+ * em O(jogadores), em vez de reprocessar todas as partidas para cada jogador.
+ *
+ * Partidas podem ser acrescentadas e consultas feitas por várias
+ * <i>threads</i> simultaneamente (por exemplo, as disputas de uma rodada de
+ * um Tournament). */
+template <class match_t, class player_t>
+class Standings {
+public:
+	/** Tipo das estatísticas de cada jogador. */
+	typedef PlayerMultipleMatchStat<match_t, player_t> stat_t;
+
+	/** Construtor. */
+	Standings() : matches(0) {}
+
+	/** Construtor de cópia. */
+	Standings(const Standings &that) : matches(0) { *this = that; }
+
+	/** Define a instância como cópia das estatísticas dadas. */
+	Standings &operator=(const Standings &that) {
+		if(this != &that) {
+			std::map<player_t *, stat_t> that_tallies;
+			unsigned int that_matches;
+			{
+				std::lock_guard<std::mutex> lock(that.mutex);
+				that_tallies = that.tallies, that_matches = that.matches;
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			tallies.swap(that_tallies), matches = that_matches;
+		}
+		return *this;
+	}
+
+	/** Acumula as estatísticas da partida dada (já disputada). */
+	void add(const match_t &match /**< [in] partida */) {
+		// uma passada pelas jogadas, antes de travar
+		std::vector<player_t *> players(match.players.begin(), match.players.end());
+		std::vector<unsigned int> moves(players.size(), 0);
+		std::vector<double> costs(players.size(), 0);
+		for(typename match_t::Move *move : match.moves) {
+			for(std::size_t i = 0; i < players.size(); ++i) {
+				if(move->player == players[i]) {
+					++moves[i], costs[i] += move->action->cost;
+					break;
+				}
+			}
+		}
+
+		std::vector<GameResult> results;
+		for(player_t *player : players) results.push_back(match.get_result(player));
+
+		std::lock_guard<std::mutex> lock(mutex);
+		for(std::size_t i = 0; i < players.size(); ++i) {
+			typename std::map<player_t *, stat_t>::iterator it = tallies.find(players[i]);
+			if(it == tallies.end()) it = tallies.insert(std::make_pair(players[i], stat_t(players[i]))).first;
+			it->second.add(moves[i], costs[i], results[i]);
+		}
+		++matches;
+	}
+
+	/** Acumula as estatísticas das partidas dadas. */
+	void add(const std::deque<match_t *> &match_list /**< [in] partidas */) {
+		for(const match_t *match : match_list) add(*match);
+	}
+
+	/** Retorna as estatísticas de cada jogador (ordenados pelo endereço, como
+	 * em MultipleMatchStat), prontas para ordenar com o critério desejado. */
+	std::deque<stat_t> stats() const {
+		std::lock_guard<std::mutex> lock(mutex);
+
+		std::deque<stat_t> player_stats;
+		for(const typename std::map<player_t *, stat_t>::value_type &tally : tallies)
+			player_stats.push_back(tally.second);
+		return player_stats;
+	}
+
+	/** Retorna o número de partidas acumuladas. */
+	unsigned int num_matches() const {
+		std::lock_guard<std::mutex> lock(mutex);
+		return matches;
+	}
+
+	/** Descarta as estatísticas acumuladas. */
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+		tallies.clear();
+		matches = 0;
+	}
+
+private:
+	// Attributes
+	mutable std::mutex mutex;
+	std::map<player_t *, stat_t> tallies;
+	unsigned int matches;
+};
+} // namespace Statistics
+} // namespace Games
+
+#endif // GAMES_STATISTICS_STANDINGS_HPP
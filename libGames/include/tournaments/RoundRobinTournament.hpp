@@ -20,16 +20,16 @@ class RoundRobin : public Tournament<match_t, player_t> {
 public:
 	/** Construtor.
 	 *
-	 * @param p os jogadores do campeonato. */
-	RoundRobin(const std::deque<player_t *> &p)
-		: Tournament<match_t, player_t> (p) {
-			srand (unsigned(time(nullptr))); // para random_shuffle
-  	}
+	 * @param p os jogadores do campeonato.
+	 * @param num_workers número máximo de disputas simultâneas. */
+	RoundRobin(const std::deque<player_t *> &p, unsigned int num_workers = 1)
+		: Tournament<match_t, player_t> (p, num_workers) {}
 
 protected:
 	void setup_players(std::deque<player_t *> &tournament_players) {
 		tournament_players.assign(this->players.begin(), this->players.end());
-		std::random_shuffle(tournament_players.begin(), tournament_players.end());
+		IIA::Utils::Random::Generator generator(this->seed, ~uint64_t(0)); // fluxo que nenhuma partida usa
+		std::shuffle(tournament_players.begin(), tournament_players.end(), generator);
 
 		/** Define o 1o elemento como "bye", se necessário" */
 		if(tournament_players.size() % 2)
@@ -47,7 +47,7 @@ protected:
 			std::deque<player_t *> match_players(1, tournament_players[j]);
 			match_players.push_back(tournament_players[j+half]);
 
-			new_round->push_back(best_out_of<match_t, player_t>(num_matches, match_players));
+			this->push_back_dispute(new_round, match_players, num_matches);
 		}
 
 		return new_round;
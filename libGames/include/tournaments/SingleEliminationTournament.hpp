@@ -29,10 +29,9 @@ template <class match_t, class player_t>
 class SingleElimination : public Tournament<match_t, player_t> {
 public:
 	/** Construtor. */
-	SingleElimination(const std::deque<player_t *> &p /**< jogadores do campeonato */)
-		: Tournament<match_t, player_t> (p), tiebreaker(simple_tiebreaker) {
-			srand (unsigned(time(nullptr))); // para random_shuffle
-	}
+	SingleElimination(const std::deque<player_t *> &p, /**< jogadores do campeonato */
+					  unsigned int num_workers = 1	 /**< número máximo de disputas simultâneas */)
+		: Tournament<match_t, player_t> (p, num_workers), tiebreaker(simple_tiebreaker) {}
 	
 	using Tournament<match_t, player_t>::run;
 	
@@ -52,7 +51,8 @@ public:
 protected:
 	void setup_players(std::deque<player_t *> &tournament_players) {
 		tournament_players.assign(this->players.begin(), this->players.end());
-		std::random_shuffle(tournament_players.begin(), tournament_players.end());
+		IIA::Utils::Random::Generator generator(this->seed, ~uint64_t(0)); // fluxo que nenhuma partida usa
+		std::shuffle(tournament_players.begin(), tournament_players.end(), generator);
 
 		int missing_players = 2;
 		while(missing_players < tournament_players.size()) missing_players *= 2;
@@ -71,7 +71,7 @@ protected:
 			match_players.push_back(tournament_players[bwd]);
 
 			if(!IIA::Utils::contains(match_players, null_player))
-				new_round->push_back(best_out_of<match_t, player_t>(num_matches, match_players));
+				this->push_back_dispute(new_round, match_players, num_matches);
 
 			++fwd, --bwd;
 		}
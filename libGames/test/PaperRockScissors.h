@@ -109,6 +109,13 @@ public:
 		return "Marcar " + IIA::Utils::String::to_string(mark);
 	}
 
+	/** Codifica a ação (para Games::Log). */
+	uint64_t code() const { return mark; }
+	/** Retorna uma nova ação a partir do código dado. */
+	static PaperRockScissorsAction *from_code(uint64_t code, double cost) {
+		return new PaperRockScissorsAction(Mark(code), cost);
+	}
+
 	/** A marca a fazer. */
 	Mark mark;
 };
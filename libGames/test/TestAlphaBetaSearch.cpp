@@ -0,0 +1,122 @@
+/** @file TestAlphaBetaSearch.cpp
+ * 
+ * Implementa testes para a classe Games::Search::AlphaBeta.
+ * 
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+ 
+#include <assert.h>
+#include <limits>
+
+#include "AlphaBetaSearch.hpp"
+
+namespace Games {
+namespace Test {
+namespace {
+// Nim com uma pilha: cada jogador retira 1, 2 ou 3 objetos, e quem retirar o
+// último vence. Quem joga com um múltiplo de 4 objetos perde.
+struct NimRules {
+	typedef unsigned int state_type;
+	typedef unsigned int move_type;
+
+	void moves(const unsigned int &objects, std::vector<unsigned int> &moves) const {
+		for(unsigned int take = 1; take <= 3 && take <= objects; ++take) moves.push_back(take);
+	}
+	void apply(unsigned int &objects, const unsigned int &take) const { objects -= take; }
+	void undo(unsigned int &objects, const unsigned int &take) const { objects += take; }
+	bool terminal(const unsigned int &objects) const { return objects == 0; }
+	// sem objetos, quem joga perdeu (o adversário retirou o último)
+	double evaluate(const unsigned int &objects) const { return (objects == 0 ? -1 : 0); }
+	uint64_t hash(const unsigned int &objects) const { return objects*0x9e3779b97f4a7c15ULL; }
+};
+
+// Minimax sem poda, para comparação.
+double minimax(const NimRules &rules, unsigned int &objects) {
+	std::vector<unsigned int> moves;
+	rules.moves(objects, moves);
+	if(moves.empty()) return rules.evaluate(objects);
+
+	double best = -std::numeric_limits<double>::infinity();
+	for(unsigned int take : moves) {
+		rules.apply(objects, take);
+		best = std::max(best, -minimax(rules, objects));
+		rules.undo(objects, take);
+	}
+	return best;
+}
+
+void test_search() {
+	constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+	NimRules rules;
+	Search::AlphaBeta<NimRules> engine(rules);
+
+	unsigned int objects = 0;
+	try {
+		engine.search(objects, UNLIMITED);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	for(objects = 1; objects <= 16; ++objects) {
+		Search::AlphaBeta<NimRules>::Result result = engine.search(objects, UNLIMITED);
+		assert(result.complete);
+		assert(result.value == minimax(rules, objects));
+		if(objects % 4) {
+			assert(result.value == 1);
+			assert((objects - result.move) % 4 == 0);
+		} else {
+			assert(result.value == -1);
+		}
+		assert(result.nodes > 0);
+	}
+
+	// profundidade limitada: resultado incompleto
+	objects = 17;
+	Search::AlphaBeta<NimRules>::Result result = engine.search(objects, UNLIMITED, 2);
+	assert(!result.complete && result.depth == 2);
+	assert(objects == 17);
+
+	// sem tempo: ainda assim retorna uma jogada válida
+	objects = 60;
+	result = engine.search(objects, 0);
+	assert(1 <= result.move && result.move <= 3);
+	assert(objects == 60);
+}
+void test_transposition_table() {
+	constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+	NimRules rules;
+	Search::TranspositionTable table(1024);
+	Search::AlphaBeta<NimRules> plain(rules), engine(rules, table);
+
+	// mesmos valores, com menos posições visitadas
+	for(unsigned int objects = 1; objects <= 16; ++objects) {
+		Search::AlphaBeta<NimRules>::Result expected = plain.search(objects, UNLIMITED);
+		Search::AlphaBeta<NimRules>::Result result = engine.search(objects, UNLIMITED);
+		assert(result.complete && result.value == expected.value);
+		if(objects % 4) assert((objects - result.move) % 4 == 0);
+		if(objects > 8) assert(result.nodes < expected.nodes);
+	}
+
+	// árvores grandes demais sem a tabela
+	for(unsigned int objects = 100; objects <= 103; ++objects) {
+		Search::AlphaBeta<NimRules>::Result result = engine.search(objects, UNLIMITED);
+		assert(result.complete && result.value == (objects % 4 ? 1 : -1));
+	}
+
+	// entradas de uma busca limitada não tornam a próxima completa
+	table.clear();
+	unsigned int objects = 30;
+	assert(!engine.search(objects, UNLIMITED, 3).complete);
+	assert(!engine.search(objects, UNLIMITED, 3).complete);
+	assert(engine.search(objects, UNLIMITED).complete);
+}
+} // unnamed namespace
+} // namespace Test
+} // namespace Games
+
+int main(int argc, char **argv) {
+	using namespace Games::Test;
+
+	test_search();
+	test_transposition_table();
+	return 0;
+}
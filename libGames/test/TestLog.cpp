@@ -0,0 +1,237 @@
+/** @file TestLog.cpp
+ *
+ * Implementa testes para o registro binário de partidas (Games::Log).
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <cstdio>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "MatchLog.hpp"
+#include "PaperRockScissors.h"
+#include "RoundRobinTournament.hpp"
+
+namespace Games {
+namespace PaperRockScissors {
+namespace Test {
+namespace {
+typedef Games::RoundRobin<PaperRockScissorsMatch, PaperRockScissorsPlayer> Tournament;
+typedef Games::Statistics::Standings<PaperRockScissorsMatch, PaperRockScissorsPlayer> Standings;
+
+// Cria um arquivo temporário vazio.
+std::string temporary_file() {
+	char path[] = "/tmp/TestLogXXXXXX";
+	int fd = mkstemp(path);
+	assert(fd >= 0);
+	close(fd);
+	return path;
+}
+
+// Jogador que só faz jogadas inválidas (mas executáveis).
+class InvalidPlayer : public PaperRockScissorsPlayer {
+public:
+	InvalidPlayer(std::string name) : PaperRockScissorsPlayer(name) {}
+
+	IIA::Action<PaperRockScissorsState> *decide_action(const PaperRockScissorsState &state) {
+		return new PaperRockScissorsAction(INVALID, 1);
+	}
+};
+
+// Retorna o índice do jogador com o nome dado.
+std::size_t find(const Games::Log::Reader &reader, const std::string &name) {
+	for(std::size_t i = 0; i < reader.players().size(); ++i)
+		if(reader.players()[i] == name) return i;
+	assert(false);
+	return 0;
+}
+
+void test_Record() {
+	assert(sizeof(Games::Log::Record) == 24);
+
+	PaperRockScissorsAction action(SCISSOR, 2.5);
+	PaperRockScissorsAction *decoded = PaperRockScissorsAction::from_code(action.code(), action.cost);
+	assert(decoded->mark == SCISSOR && decoded->cost == 2.5);
+	delete decoded;
+}
+
+void test_tournament() {
+	RandomPlayer p1("p1"), p2("p2"), p3("p3");
+	PaperPlayer p4("p4_with_a_name_longer_than_one_record");
+	std::deque<PaperRockScissorsPlayer *> players;
+	players.push_back(&p1), players.push_back(&p2), players.push_back(&p3), players.push_back(&p4);
+
+	Tournament tournament(players);
+	tournament.seed = 42;
+	tournament.run(3);
+
+	const std::string path = temporary_file();
+	{
+		Games::Log::Writer writer(path);
+		writer.write_tournament(tournament);
+	}
+
+	Games::Log::Reader reader(path);
+	assert(reader.players().size() == players.size());
+	assert(reader.tournaments().size() == 1);
+	assert(reader.tournaments()[0].seed == 42);
+	assert(reader.tournaments()[0].num_players == players.size());
+	assert(reader.tournaments()[0].num_rounds == tournament.rounds.size());
+
+	// mesmas partidas, na mesma ordem, com as mesmas jogadas
+	std::size_t m = 0;
+	for(std::size_t r = 0; r < tournament.rounds.size(); ++r) {
+		for(std::size_t d = 0; d < tournament.rounds[r].size(); ++d) {
+			for(std::size_t k = 0; k < tournament.rounds[r][d].size(); ++k, ++m) {
+				const PaperRockScissorsMatch *match = tournament.rounds[r][d][k];
+				const Games::Log::Reader::Match &logged = reader.matches().at(m);
+				assert(logged.id == (Tournament::match_id(r, d) | k));
+				assert(logged.tournament == 0);
+				assert(logged.invalid_move == -1);
+				assert(logged.num_moves == match->moves.size());
+				for(std::size_t i = 0; i < logged.num_moves; ++i) {
+					assert(reader.players()[logged.player(i)] == IIA::Utils::String::to_string(*match->moves[i]->player));
+					assert(logged.moves[i].code == match->moves[i]->action->code());
+					assert(logged.moves[i].value == match->moves[i]->action->cost);
+				}
+				for(std::size_t i = 0; i < logged.players.size(); ++i)
+					assert(logged.results[i] == match->get_result(match->players[i]));
+
+				assert((reader.replay<PaperRockScissorsState, PaperRockScissorsAction>(m) == match->result()));
+			}
+		}
+	}
+	assert(m == reader.matches().size());
+
+	// agregado == classificação do campeonato
+	std::vector<Games::Log::Reader::Summary> summaries = reader.summarize();
+	for(const Standings::stat_t &stat : tournament.standings.stats()) {
+		const Games::Log::Reader::Summary &summary = summaries[find(reader, IIA::Utils::String::to_string(*stat.player))];
+		assert(summary.num_matches == stat.num_matches);
+		assert(summary.num_victories == stat.num_victories);
+		assert(summary.num_defeats == stat.num_defeats);
+		assert(summary.num_draws == stat.num_draws);
+		assert(summary.num_moves == stat.num_moves);
+		assert(summary.total_cost == stat.total_cost);
+	}
+
+	std::remove(path.c_str());
+}
+
+void test_sessions() {
+	PaperPlayer pp("pp");
+	RockPlayer rp("rp");
+	std::deque<PaperRockScissorsPlayer *> players;
+	players.push_back(&pp), players.push_back(&rp);
+
+	PaperRockScissorsMatch match(players);
+	match.play();
+
+	const std::string path = temporary_file();
+	for(int session = 0; session < 2; ++session) {
+		Games::Log::Writer writer(path);
+		writer.write(match, session);
+		writer.write(match, session);
+	}
+
+	// escrita interrompida: registro incompleto no final
+	std::FILE *file = std::fopen(path.c_str(), "ab");
+	std::fputs("partial", file);
+	std::fclose(file);
+
+	Games::Log::Reader reader(path);
+	assert(reader.players().size() == 2); // unificados pelo nome
+	assert(reader.matches().size() == 4);
+	assert(reader.tournaments().empty());
+	for(const Games::Log::Reader::Match &logged : reader.matches()) {
+		assert(logged.tournament == -1);
+		assert(reader.players()[logged.players[0]] == "pp");
+		assert(logged.results[0] == Games::VICTORY && logged.results[1] == Games::DEFEAT);
+	}
+	assert(reader.matches()[3].id == 1);
+
+	std::vector<Games::Log::Reader::Summary> summaries = reader.summarize();
+	assert(summaries[find(reader, "pp")].num_victories == 4);
+	assert(summaries[find(reader, "rp")].num_defeats == 4);
+	assert(summaries[find(reader, "rp")].num_moves == 2 * match.moves.size());
+
+	std::remove(path.c_str());
+}
+
+void test_invalid_move() {
+	PaperPlayer pp("pp");
+	InvalidPlayer ip("ip");
+	std::deque<PaperRockScissorsPlayer *> players;
+	players.push_back(&pp), players.push_back(&ip);
+
+	// a partida termina na jogada inválida, que é registrada mas não refeita
+	PaperRockScissorsMatch match(players);
+	match.play();
+	assert(match.moves.size() == 2 && match.invalid_move() == match.moves[1]);
+
+	const std::string path = temporary_file();
+	{
+		Games::Log::Writer writer(path);
+		writer.write(match);
+	}
+
+	Games::Log::Reader reader(path);
+	const Games::Log::Reader::Match &logged = reader.matches().at(0);
+	assert(logged.num_moves == 2);
+	assert(logged.moves[1].code == INVALID);
+	assert(logged.invalid_move == 1);
+
+	const PaperRockScissorsState state = reader.replay<PaperRockScissorsState, PaperRockScissorsAction>(0);
+	assert(state == match.result());
+	assert(state.marks.size() == 1 && state.marks[0] == PAPER);
+
+	std::remove(path.c_str());
+}
+
+void test_invalid() {
+	try {
+		Games::Log::Reader reader("/nonexistent/TestLog");
+		assert(false);
+	} catch(std::runtime_error e) {}
+
+	try {
+		Games::Log::Writer writer("/nonexistent/TestLog");
+		assert(false);
+	} catch(std::runtime_error e) {}
+
+	const std::string path = temporary_file();
+	try { // vazio
+		Games::Log::Reader reader(path);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	std::FILE *file = std::fopen(path.c_str(), "ab");
+	Games::Log::Record record = {};
+	record.type = Games::Log::SESSION;
+	std::fwrite(&record, sizeof(record), 1, file);
+	std::fclose(file);
+	try { // sem o número mágico
+		Games::Log::Reader reader(path);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	std::remove(path.c_str());
+}
+} // unnamed namespace
+} // namespace Test
+} // namespace PaperRockScissors
+} // namespace Games
+
+int main(int argc, char **argv) {
+	using namespace Games::PaperRockScissors::Test;
+
+	test_Record();
+	test_tournament();
+	test_sessions();
+	test_invalid_move();
+	test_invalid();
+
+	return 0;
+}
@@ -142,6 +142,60 @@ void test_Match() {
 	// deixar uma exceção subir.
 }
 
+void test_result() {
+	RandomPlayer rp("RandomPlayer");
+	RandomPlayer rp2("RandomPlayer2");
+	std::set<PaperRockScissorsPlayer *> players;
+	players.insert(&rp), players.insert(&rp2);
+	
+	PaperRockScissorsMatch match(players);
+	assert(match.result().marks.empty() && !match.invalid_move());
+
+	// o estado final de play() é mantido
+	PaperRockScissorsState game = match.play();
+	assert(match.result() == game);
+	assert(&match.result() == &match.result());
+	assert(!match.invalid_move());
+
+	// jogadas acrescentadas são executadas
+	match.moves.push_back(new PaperRockScissorsMatch::Move(&rp, new PaperRockScissorsAction(PAPER, 1)));
+	game.marks.push_back(PAPER);
+	assert(match.result() == game);
+
+	// jogada inválida: as seguintes são ignoradas
+	PaperRockScissorsMatch::Move *invalid = new PaperRockScissorsMatch::Move(&rp2, new PaperRockScissorsAction(INVALID, 1));
+	match.moves.push_back(invalid);
+	match.moves.push_back(new PaperRockScissorsMatch::Move(&rp, new PaperRockScissorsAction(ROCK, 1)));
+	assert(match.result() == game);
+	assert(match.invalid_move() == invalid);
+
+	// outra sequência: refaz a partida
+	match.moves.push_front(new PaperRockScissorsMatch::Move(&rp2, new PaperRockScissorsAction(SCISSOR, 1)));
+	match.invalidate();
+	game.marks.push_front(SCISSOR);
+	assert(match.result() == game);
+	assert(match.invalid_move() == invalid);
+
+	// jogada substituída (possivelmente no mesmo endereço): refaz a partida
+	const std::size_t last = match.moves.size() - 1;
+	delete match.moves[last - 2];
+	match.moves[last - 2] = new PaperRockScissorsMatch::Move(&rp, new PaperRockScissorsAction(ROCK, 1));
+	delete match.moves.back(), match.moves.pop_back();
+	match.moves.push_back(new PaperRockScissorsMatch::Move(&rp, new PaperRockScissorsAction(PAPER, 1)));
+	match.invalidate();
+	game.marks.back() = ROCK;
+	assert(match.result() == game);
+	assert(match.invalid_move() == invalid);
+
+	// jogadas removidas são detectadas
+	delete match.moves.back(), match.moves.pop_back();
+	delete match.moves.back(), match.moves.pop_back();
+	assert(match.result() == game);
+	assert(!match.invalid_move());
+
+	IIA::Utils::empty(match.moves);
+	assert(match.result().marks.empty() && !match.invalid_move());
+}
 } // namespace Test
 } // namespace PaperRockScissors
 } // namespace Games
@@ -154,6 +208,7 @@ int main(int argc, char **argv) {
 	test_Action();
 	test_RandomPlayer();
 	test_Match();
+	test_result();
 	
 	return 0;
 }
@@ -0,0 +1,125 @@
+/** @file TestMonteCarloSearch.cpp
+ * 
+ * Implementa testes para a classe Games::Search::MonteCarlo.
+ * 
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+ 
+#include <assert.h>
+#include <limits>
+
+#include "MonteCarloSearch.hpp"
+
+namespace Games {
+namespace Test {
+namespace {
+// Nim com uma pilha: cada jogador retira 1, 2 ou 3 objetos, e quem retirar o
+// último vence. Quem joga com um múltiplo de 4 objetos perde.
+struct NimRules {
+	typedef unsigned int state_type;
+	typedef unsigned int move_type;
+
+	void moves(const unsigned int &objects, std::vector<unsigned int> &moves) const {
+		for(unsigned int take = 1; take <= 3 && take <= objects; ++take) moves.push_back(take);
+	}
+	void apply(unsigned int &objects, const unsigned int &take) const { objects -= take; }
+	void undo(unsigned int &objects, const unsigned int &take) const { objects += take; }
+	bool terminal(const unsigned int &objects) const { return objects == 0; }
+	// sem objetos, quem joga perdeu (o adversário retirou o último)
+	double evaluate(const unsigned int &objects) const { return (objects == 0 ? -1 : 0); }
+};
+
+void test_search() {
+	constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+	NimRules rules;
+
+	try {
+		Search::MonteCarlo<NimRules> engine(rules, 0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	Search::MonteCarlo<NimRules> engine(rules);
+	unsigned int objects = 0;
+	try {
+		engine.search(objects, UNLIMITED);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	// encontra a jogada vencedora
+	for(objects = 1; objects <= 11; ++objects) {
+		if(objects % 4 == 0) continue;
+
+		engine.reset();
+		Search::MonteCarlo<NimRules>::Result result = engine.search(objects, UNLIMITED, 5000);
+		assert(result.playouts == 5000);
+		assert((objects - result.move) % 4 == 0);
+		assert(result.value > 0.5);
+	}
+
+	// sem tempo: ainda assim uma simulação e uma jogada válida
+	engine.reset();
+	objects = 30;
+	Search::MonteCarlo<NimRules>::Result result = engine.search(objects, 0);
+	assert(result.playouts >= 1 && 1 <= result.move && result.move <= 3);
+	assert(objects == 30);
+
+	// mesma semente, mesmo resultado
+	Search::MonteCarlo<NimRules> a(rules, 1, 7), b(rules, 1, 7);
+	Search::MonteCarlo<NimRules>::Result ra = a.search(objects, UNLIMITED, 1000), rb = b.search(objects, UNLIMITED, 1000);
+	assert(ra.move == rb.move && ra.value == rb.value && a.size() == b.size());
+}
+
+void test_advance() {
+	constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+	NimRules rules;
+	Search::MonteCarlo<NimRules> engine(rules);
+
+	unsigned int objects = 10;
+	Search::MonteCarlo<NimRules>::Result result = engine.search(objects, UNLIMITED, 2000);
+	assert(result.visits == 2000);
+	const std::size_t size = engine.size();
+
+	// a subárvore da jogada é mantida (com suas visitas)
+	engine.advance(result.move);
+	objects -= result.move;
+	assert(0 < engine.size() && engine.size() < size);
+	engine.advance(1);
+	objects -= 1;
+	result = engine.search(objects, UNLIMITED, 100);
+	assert(result.playouts == 100 && result.visits > 100);
+
+	// jogada não expandida: recomeça
+	engine.advance(3), engine.advance(3), engine.advance(3);
+	assert(engine.size() == 0);
+}
+
+void test_workers() {
+	constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+	NimRules rules;
+	Search::MonteCarlo<NimRules> engine(rules, 4);
+
+	unsigned int objects = 11;
+	Search::MonteCarlo<NimRules>::Result result = engine.search(objects, UNLIMITED, 2000);
+	assert(result.playouts == 4*2000 && result.visits == 4*2000);
+	assert(result.move == 3);
+	assert(objects == 11);
+
+	// tempo limitado
+	objects = 40;
+	engine.reset();
+	result = engine.search(objects, 1e7);
+	assert(result.playouts >= 4);
+	assert(result.cpu_ns > 4*1e7); // todas as threads
+}
+} // unnamed namespace
+} // namespace Test
+} // namespace Games
+
+int main(int argc, char **argv) {
+	using namespace Games::Test;
+
+	test_search();
+	test_advance();
+	test_workers();
+	return 0;
+}
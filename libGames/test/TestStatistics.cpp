@@ -22,6 +22,7 @@ typedef Games::Statistics::PlayerMatchStat<PaperRockScissorsMatch, PaperRockScis
 typedef Games::Statistics::PlayerMultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> PlayerMultiple;
 typedef Games::Statistics::MatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> MatchSingle;
 typedef Games::Statistics::MultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> MatchMultiple;
+typedef Games::Statistics::Standings<PaperRockScissorsMatch, PaperRockScissorsPlayer> Standings;
 
 void test_Player_Statistic() {
 	try {
@@ -180,6 +181,53 @@ void test_Match_Multiple() {
 	IIA::Utils::empty(matches);
 }
 
+void test_Standings() {
+	RandomPlayer p1("p1"), p2("p2"), p3("p3");
+	PaperPlayer p4("p4");
+	std::deque<PaperRockScissorsPlayer *> all;
+	all.push_back(&p1), all.push_back(&p2), all.push_back(&p3), all.push_back(&p4);
+
+	std::deque<PaperRockScissorsMatch *> matches;
+	for(std::size_t i = 0; i < all.size(); ++i) {
+		for(std::size_t j = i + 1; j < all.size(); ++j) {
+			std::set<PaperRockScissorsPlayer *> players;
+			players.insert(all[i]), players.insert(all[j]);
+			for(int k = 0; k < 3; ++k) {
+				matches.push_back(new PaperRockScissorsMatch(players));
+				matches.back()->play();
+			}
+		}
+	}
+
+	Standings standings;
+	assert(standings.stats().empty() && standings.num_matches() == 0);
+
+	// acumulado partida a partida == recalculado para cada jogador
+	for(PaperRockScissorsMatch *match : matches) standings.add(*match);
+	assert(standings.num_matches() == matches.size());
+	std::deque<PlayerMultiple> stats = standings.stats();
+	assert(stats.size() == all.size());
+	for(const PlayerMultiple &stat : stats) {
+		PlayerMultiple expected(matches, stat.player);
+		assert(stat.num_moves == expected.num_moves && stat.total_cost == expected.total_cost);
+		assert(stat.num_matches == expected.num_matches && stat.num_matches == 9);
+		assert(stat.num_victories == expected.num_victories);
+		assert(stat.num_defeats == expected.num_defeats);
+		assert(stat.num_draws == expected.num_draws);
+	}
+
+	MatchMultiple from_standings(standings), from_matches(matches);
+	assert(from_standings.num_moves == from_matches.num_moves);
+	assert(from_standings.player_stats.size() == from_matches.player_stats.size());
+	for(std::size_t i = 0; i < from_matches.player_stats.size(); ++i)
+		assert(from_standings.player_stats[i].player == from_matches.player_stats[i].player);
+
+	standings.clear();
+	assert(standings.stats().empty() && standings.num_matches() == 0);
+
+	IIA::Utils::empty(matches);
+}
+
 void test_Sort_Players() {
 	RandomPlayer p1("p1");
 	RandomPlayer p2("p2");
@@ -266,6 +314,7 @@ int main(int argc, char **argv) {
 	test_Player_PlayerMultipleMatchStat();
 	test_Match_Single();
 	test_Match_Multiple();
+	test_Standings();
 	test_Sort_Players();
 	test_Sort_Match_Single();
 	test_Sort_Match_Multiple();
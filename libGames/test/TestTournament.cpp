@@ -6,6 +6,7 @@
  * @date 07/2012 */
  
 #include <assert.h>
+#include <sstream>
 
 #include "PaperRockScissors.h"
 #include "MatchStats.hpp"
@@ -113,6 +114,95 @@ void test_RoundRobin() {
 	assert(tournament.rounds.size() == players.size());
 }
 
+void test_concurrent_rounds() {
+	PaperPlayer pp;
+	RockPlayer rp;
+	ScissorsPlayer sp;
+	PaperPlayer pp2("PaperPlayer2");
+	std::deque<PaperRockScissorsPlayer *> players;
+	players.push_back(&pp), players.push_back(&rp);
+
+	try {
+		Games::RoundRobin<PaperRockScissorsMatch, PaperRockScissorsPlayer> tournament(players, 0);
+		assert(false);
+	} catch (std::invalid_argument e) {}
+
+	players.push_back(&sp), players.push_back(&pp2);
+	Games::RoundRobin<PaperRockScissorsMatch, PaperRockScissorsPlayer> tournament(players, 4);
+	tournament.run(3);
+
+	// 4 jogadores: 3 rodadas com 2 disputas cada, todas executadas
+	assert(tournament.rounds.size() == players.size() - 1);
+	std::deque<PaperRockScissorsMatch *> matches;
+	for(std::deque<std::deque<PaperRockScissorsMatch *> > round : tournament.rounds) {
+		assert(round.size() == 2);
+		for(std::deque<PaperRockScissorsMatch *> dispute : round) {
+			assert(!dispute.empty());
+			for(PaperRockScissorsMatch *match : dispute) {
+				assert(!match->moves.empty());
+				matches.push_back(match);
+			}
+		}
+	}
+
+	// os resultados não dependem da execução concorrente
+	Games::Statistics::MultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> stats(matches);
+	assert(tournament.standings.num_matches() == matches.size());
+	std::deque<Games::Statistics::PlayerMultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> >
+		standings = tournament.standings.stats();
+	assert(standings.size() == stats.player_stats.size());
+	for(std::size_t i = 0; i < standings.size(); ++i) {
+		assert(standings[i].player == stats.player_stats[i].player);
+		assert(standings[i].num_victories == stats.player_stats[i].num_victories);
+		assert(standings[i].num_moves == stats.player_stats[i].num_moves);
+	}
+	for(auto stat : stats.player_stats) {
+		if(stat.player == &rp)
+			assert(stat.num_victories == 2 && stat.num_defeats == 4);
+		else if(stat.player == &sp)
+			assert(stat.num_victories == 4 && stat.num_defeats == 2);
+	}
+
+	Games::SingleElimination<PaperRockScissorsMatch, PaperRockScissorsPlayer> elimination(players, 2);
+	elimination.run();
+	assert(elimination.rounds.size() == 2);
+	assert(elimination.rounds[0].size() == 2);
+	assert(elimination.rounds[1].size() == 1);
+}
+
+// Representa o campeonato pela sequência de jogadas de todas as partidas.
+template <class tournament_t>
+std::string moves_of(const tournament_t &tournament) {
+	std::ostringstream os;
+	for(std::deque<std::deque<PaperRockScissorsMatch *> > round : tournament.rounds)
+		for(std::deque<PaperRockScissorsMatch *> dispute : round)
+			for(PaperRockScissorsMatch *match : dispute)
+				for(auto move : match->moves)
+					os << *(move->player) << move->action->mark << ";";
+	return os.str();
+}
+
+void test_reproducible_tournament() {
+	RandomPlayer rp1("rp1"), rp2("rp2"), rp3("rp3"), rp4("rp4"), rp5("rp5"), rp6("rp6");
+	std::deque<PaperRockScissorsPlayer *> players;
+	players.push_back(&rp1), players.push_back(&rp2), players.push_back(&rp3);
+	players.push_back(&rp4), players.push_back(&rp5), players.push_back(&rp6);
+
+	// mesma semente: mesmo campeonato, com ou sem execução concorrente
+	Games::RoundRobin<PaperRockScissorsMatch, PaperRockScissorsPlayer> sequential(players);
+	sequential.seed = 2026;
+	sequential.run(5);
+
+	Games::RoundRobin<PaperRockScissorsMatch, PaperRockScissorsPlayer> concurrent(players, 3);
+	concurrent.seed = 2026;
+	concurrent.run(5);
+	assert(moves_of(sequential) == moves_of(concurrent));
+
+	concurrent.seed = 2027;
+	concurrent.run(5);
+	assert(moves_of(sequential) != moves_of(concurrent));
+}
+
 bool tiebreaker(const Games::Statistics::PlayerMultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> &lhs, 
 			    const Games::Statistics::PlayerMultipleMatchStat<PaperRockScissorsMatch, PaperRockScissorsPlayer> &rhs) {
 	if(lhs.player == rhs.player) return false;
@@ -211,6 +301,8 @@ int main(int argc, char **argv) {
 	test_best_out_of();
 	test_RoundRobin();
 	test_SingleElimination();
+	test_concurrent_rounds();
+	test_reproducible_tournament();
 	return 0;
 }
 
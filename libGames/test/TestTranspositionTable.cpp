@@ -0,0 +1,114 @@
+/** @file TestTranspositionTable.cpp
+ * 
+ * Implementa testes para as classes Games::Search::TranspositionTable e
+ * Games::Search::Zobrist.
+ * 
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+ 
+#include <assert.h>
+#include <thread>
+
+#include "TranspositionTable.hpp"
+#include "Zobrist.hpp"
+
+namespace Games {
+namespace Test {
+namespace {
+void test_Zobrist() {
+	try {
+		Search::Zobrist zobrist(0, 2);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	// chaves determinísticas e distintas
+	Search::Zobrist zobrist(9, 3), other(9, 3);
+	for(unsigned int cell = 0; cell < 9; ++cell) {
+		for(unsigned int mark = 0; mark < 3; ++mark) {
+			assert(zobrist.key(cell, mark) == other.key(cell, mark));
+			assert(zobrist.key(cell, mark) != zobrist.turn());
+			if(cell) assert(zobrist.key(cell, mark) != zobrist.key(cell - 1, mark));
+		}
+	}
+
+	// hash completo == XOR das casas marcadas
+	Grids::Grid2D<int> grid(3, 3, 0);
+	assert(zobrist.hash(grid, 0) == 0);
+	uint64_t hash = 0;
+	Grids::Coord2D coord(1, 2);
+	grid[coord] = 1, hash ^= zobrist.key(1*3 + 2, 1);
+	assert(zobrist.hash(grid, 0) == hash);
+	coord.row = 2, coord.col = 0;
+	grid[coord] = 2, hash ^= zobrist.key(2*3 + 0, 2);
+	assert(zobrist.hash(grid, 0) == hash);
+	grid[coord] = 0, hash ^= zobrist.key(2*3 + 0, 2);
+	assert(zobrist.hash(grid, 0) == hash);
+}
+
+void test_TranspositionTable() {
+	try {
+		Search::TranspositionTable table(0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	assert(Search::TranspositionTable(1).size() == 1);
+	assert(Search::TranspositionTable(1000).size() == 512);
+	Search::TranspositionTable table(1024);
+	assert(table.size() == 1024);
+
+	Search::TranspositionTable::Entry entry;
+	const uint64_t key = 0x123456789abcdef0ULL;
+	assert(!table.probe(key, entry));
+
+	table.store(key, -2.5, 4, Search::TranspositionTable::LOWER, 7);
+	assert(table.probe(key, entry));
+	assert(entry.value == -2.5 && entry.depth == 4 && entry.move == 7);
+	assert(entry.bound == Search::TranspositionTable::LOWER);
+	assert(!table.probe(key + 1, entry)); 	// outro índice
+	assert(!table.probe(key ^ (uint64_t(1) << 40), entry)); // mesmo índice, outra chave
+
+	// a mesma posição só é substituída por busca ao menos tão profunda
+	table.store(key, 1, 3, Search::TranspositionTable::EXACT, 2);
+	assert(table.probe(key, entry) && entry.depth == 4 && entry.value == -2.5);
+	table.store(key, 1e6, Search::TranspositionTable::COMPLETE, Search::TranspositionTable::EXACT, 2);
+	assert(table.probe(key, entry) && entry.depth == Search::TranspositionTable::COMPLETE && entry.value == 1e6);
+
+	// outra posição no mesmo índice sempre substitui
+	const uint64_t other = key ^ (uint64_t(1) << 40);
+	table.store(other, 0, 1, Search::TranspositionTable::UPPER, 0);
+	assert(table.probe(other, entry) && !table.probe(key, entry));
+
+	table.clear();
+	assert(!table.probe(other, entry));
+}
+
+void test_concurrent_access() {
+	// entradas lidas durante escritas concorrentes são sempre consistentes
+	Search::TranspositionTable table(64);
+	std::vector<std::thread> threads;
+	for(unsigned int t = 0; t < 4; ++t) {
+		threads.push_back(std::thread([&table, t]() {
+			Search::TranspositionTable::Entry entry;
+			for(uint64_t i = 1; i <= 100000; ++i) {
+				uint64_t key = i*0x9e3779b97f4a7c15ULL;
+				unsigned int value = (key >> 20) & 0xFFFF;
+				table.store(key, value, t + 1, Search::TranspositionTable::EXACT, value & 0xFF);
+				if(table.probe(key, entry))
+					assert(entry.move == (unsigned int)(entry.value) % 256);
+			}
+		}));
+	}
+	for(std::thread &thread : threads) thread.join();
+}
+} // unnamed namespace
+} // namespace Test
+} // namespace Games
+
+int main(int argc, char **argv) {
+	using namespace Games::Test;
+
+	test_Zobrist();
+	test_TranspositionTable();
+	test_concurrent_access();
+	return 0;
+}
@@ -0,0 +1,314 @@
+/** @file Benchmark.cpp
+ *
+ * Mede o desempenho das buscas da biblioteca nos problemas dos exemplos.
+ *
+ * Cada busca é executada uma vez por instância, e o resultado é escrito na
+ * saída padrão em formato CSV (uma linha por busca), para que regressões e
+ * melhorias possam ser acompanhadas entre versões:
+ *
+ * problem,instance,search,status,depth,cost,nodes,cpu_ns,nodes_per_sec,allocations,allocations_per_node,peak_bytes,wall_ns
+ *
+ * - <i>nodes</i>: nós criados (IIA::Search::Result::expanded_nodes);
+ * - <i>cpu_ns</i>: tempo de CPU até a solução (todas as <i>threads</i>);
+ * - <i>allocations</i>: chamadas a operator new durante a busca;
+ * - <i>peak_bytes</i>: pico de memória dinâmica (além da já alocada antes da
+ * busca);
+ * - <i>wall_ns</i>: tempo real até a solução (para as buscas paralelas).
+ *
+ * Opcionalmente, as buscas instrumentadas (BreadthFirst::search_graph,
+ * UniformCost e AStar) são executadas novamente com um Search::SearchStats, e
+ * seus contadores são escritos no arquivo dado em formato <i>JSON lines</i>.
+ *
+ * Uso: Benchmark [profundidade máxima do N-Puzzle (padrão: 24)] [arquivo.jsonl]
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <vector>
+
+#include "libIIA.h"
+
+#include "JugsProblem.h"
+#include "MissionariesAction.h"
+#include "MissionariesProblem.h"
+#include "NPuzzleHeuristics.h"
+#include "NPuzzleProblem.h"
+#include "RomaniaProblem.h"
+
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+// Contabilização da memória dinâmica: cada bloco guarda seu tamanho em um
+// cabeçalho (alinhado), o que permite acompanhar o total alocado e o pico
+// (também nas buscas paralelas, daí os contadores atômicos).
+namespace {
+constexpr std::size_t HEADER = 16;
+
+std::atomic<std::size_t> allocations(0);
+std::atomic<std::size_t> live_bytes(0);
+std::atomic<std::size_t> peak_bytes(0);
+
+void *allocate(std::size_t size) {
+	char *block = static_cast<char *>(std::malloc(size + HEADER));
+	if(!block) return nullptr;
+
+	*reinterpret_cast<std::size_t *>(block) = size;
+	++allocations;
+	const std::size_t live = (live_bytes += size);
+	std::size_t peak = peak_bytes.load();
+	while(live > peak && !peak_bytes.compare_exchange_weak(peak, live));
+	return block + HEADER;
+}
+
+void deallocate(void *ptr) {
+	if(!ptr) return;
+
+	char *block = static_cast<char *>(ptr) - HEADER;
+	live_bytes -= *reinterpret_cast<std::size_t *>(block);
+	std::free(block);
+}
+} // unnamed namespace
+
+void *operator new(std::size_t size) {
+	void *ptr = allocate(size);
+	if(!ptr) throw std::bad_alloc();
+	return ptr;
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+void operator delete(void *ptr) noexcept { deallocate(ptr); }
+void operator delete[](void *ptr) noexcept { deallocate(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { deallocate(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { deallocate(ptr); }
+/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace IIA {
+/** Define o escopo do benchmark das buscas. */
+namespace Benchmark {
+namespace {
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+// Buscas em árvore (sem verificação de estados repetidos) crescem
+// exponencialmente com a profundidade da solução; acima deste limite, apenas
+// as buscas em grafo e as informadas são medidas.
+constexpr unsigned int TREE_SEARCH_MAX_DEPTH = 12;
+
+// Número de threads das buscas paralelas: 1 (custo da sincronização) e todas
+// as disponíveis.
+std::vector<unsigned int> parallel_workers;
+
+// Destino dos contadores das buscas instrumentadas (nulo: desabilitado).
+Search::JsonLinesExporter *exporter = nullptr;
+
+// Executa e mede a busca dada, escrevendo uma linha CSV.
+template <class state_t>
+void run(const std::string &problem, const std::string &instance, const std::string &search_name,
+		 const std::function<Search::Result<state_t>()> &search) {
+	const std::size_t start_allocations = allocations;
+	const std::size_t start_bytes = live_bytes;
+	peak_bytes = live_bytes.load();
+
+	timespec start_time, end_time;
+	const std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+	Utils::Time::get_cpu_time(start_time);
+	Search::Result<state_t> result = search();
+	Utils::Time::get_cpu_time(end_time);
+	const double wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wall_start).count();
+
+	const std::size_t search_allocations = allocations - start_allocations;
+	const std::size_t search_peak = peak_bytes - start_bytes;
+	const double cpu_ns = Utils::Time::to_nano(Utils::Time::time_diff(start_time, end_time));
+
+	double cost = 0;
+	for(auto action : result.actions) cost += action->cost;
+
+	const double nodes = result.expanded_nodes;
+	std::ostringstream line;
+	line << std::fixed << std::setprecision(0)
+		 << problem << ',' << instance << ',' << search_name << ',' << result.status << ','
+		 << result.actions.size() << ',' << cost << ',' << result.expanded_nodes << ','
+		 << cpu_ns << ',' << (cpu_ns > 0 ? 1e9 * nodes / cpu_ns : 0) << ','
+		 << search_allocations << ',' << std::setprecision(2) << (nodes > 0 ? search_allocations / nodes : 0) << ','
+		 << search_peak << ',' << std::setprecision(0) << wall_ns;
+	std::cout << line.str() << std::endl;
+}
+
+// Se o rastreamento estiver habilitado, executa a busca dada com um
+// SearchStats e escreve seus contadores.
+template <class state_t>
+void trace(const std::string &problem, const std::string &instance, const std::string &search_name,
+		   const std::function<Search::Result<state_t>(Search::SearchStats &)> &search) {
+	if(!exporter) return;
+
+	Search::SearchStats stats;
+	Search::Result<state_t> result = search(stats);
+	exporter->write({{"problem", problem}, {"instance", instance}, {"search", search_name}}, stats, result);
+}
+
+// Executa as buscas sem conhecimento no problema dado.
+template <class state_t>
+void run_uninformed(const std::string &name, const std::string &instance, const Problem<state_t> &problem,
+					bool tree_searches = true, unsigned int depth_limit = 20) {
+	using namespace Search::Uninformed;
+	typedef Search::Result<state_t> result_t;
+
+	if(tree_searches) {
+		run<state_t>(name, instance, "BreadthFirst::search_tree", [&problem]() -> result_t { return BreadthFirst::search_tree(problem); });
+		run<state_t>(name, instance, "DepthLimited", [&problem, depth_limit]() -> result_t { return DepthLimited::search(problem, depth_limit); });
+		run<state_t>(name, instance, "IterativeDeepening", [&problem]() -> result_t { return IterativeDeepening::search(problem); });
+	}
+	run<state_t>(name, instance, "BreadthFirst::search_graph", [&problem]() -> result_t { return BreadthFirst::search_graph(problem); });
+	trace<state_t>(name, instance, "BreadthFirst::search_graph", [&problem](Search::SearchStats &stats) -> result_t { return BreadthFirst::search_graph(problem, stats); });
+	for(unsigned int workers : parallel_workers) {
+		std::ostringstream search_name;
+		search_name << "BreadthFirst::parallel_search_graph(" << workers << ')';
+		run<state_t>(name, instance, search_name.str(), [&problem, workers]() -> result_t { return BreadthFirst::parallel_search_graph(problem, workers); });
+	}
+	run<state_t>(name, instance, "UniformCost", [&problem]() -> result_t { return UniformCost::search(problem); });
+	trace<state_t>(name, instance, "UniformCost", [&problem](Search::SearchStats &stats) -> result_t { return UniformCost::search(problem, stats); });
+	run<state_t>(name, instance, "Bidirectional", [&problem]() -> result_t { return Bidirectional::search(problem); });
+}
+
+// N-Puzzle (3x3) cuja solução ótima tem <i>depth</i> movimentos: o tabuleiro
+// é embaralhado por um passeio aleatório (reprodutível), sem desfazer o
+// movimento anterior, até que a solução (A*) tenha o tamanho desejado.
+Examples::NPuzzle::NPuzzleState scramble(unsigned int depth) {
+	using namespace Examples::NPuzzle;
+
+	const NPuzzleState goal(3);
+	NPuzzleProblem moves(goal, goal);
+	Utils::Random::Generator generator(depth);
+
+	NPuzzleState state(goal), previous(goal);
+	std::size_t solution = 0;
+	while(solution != depth) {
+		ActionId id = generator() % moves.num_actions();
+		if(!moves.applicable(state, id)) continue;
+
+		NPuzzleState next(state);
+		moves.execute(next, id);
+		if(next == previous) continue;
+		previous = state, state = next;
+
+		NPuzzleProblem problem(state, goal);
+		ManhattanDistance h_calc(&(problem.goal_states));
+		solution = Search::Informed::AStar::search(problem, h_calc).actions.size();
+	}
+	return state;
+}
+
+void run_npuzzle(unsigned int max_depth) {
+	using namespace Examples::NPuzzle;
+	typedef Search::Result<NPuzzleState> result_t;
+
+	for(unsigned int depth = 4; depth <= max_depth; depth += 4) {
+		NPuzzleProblem problem(scramble(depth), NPuzzleState(3));
+		ManhattanDistance h_calc(&(problem.goal_states));
+
+		std::ostringstream instance;
+		instance << "depth" << depth;
+		run_uninformed("NPuzzle", instance.str(), problem, depth <= TREE_SEARCH_MAX_DEPTH, depth);
+
+		using namespace Search::Informed;
+		run<NPuzzleState>("NPuzzle", instance.str(), "AStar", [&problem, &h_calc]() -> result_t { return AStar::search(problem, h_calc); });
+		trace<NPuzzleState>("NPuzzle", instance.str(), "AStar", [&problem, &h_calc](Search::SearchStats &stats) -> result_t { return AStar::search(problem, h_calc, stats); });
+		run<NPuzzleState>("NPuzzle", instance.str(), "BestFirst", [&problem, &h_calc]() -> result_t { return BestFirst::search(problem, h_calc); });
+		run<NPuzzleState>("NPuzzle", instance.str(), "IDAStar", [&problem, &h_calc]() -> result_t { return IDAStar::search(problem, h_calc); });
+		for(unsigned int workers : parallel_workers) {
+			std::ostringstream search_name;
+			search_name << "HDAStar(" << workers << ')';
+			run<NPuzzleState>("NPuzzle", instance.str(), search_name.str(), [&problem, &h_calc, workers]() -> result_t { return HDAStar::search(problem, h_calc, workers); });
+		}
+	}
+}
+
+void run_romania() {
+	using namespace Examples::Romania;
+
+	RomaniaProblem arad("Arad", "Bucharest");
+	run_uninformed("Romania", "Arad-Bucharest", arad);
+
+	RomaniaProblem oradea("Oradea", "Eforie");
+	run_uninformed("Romania", "Oradea-Eforie", oradea);
+}
+
+void run_jugs() {
+	using namespace Examples::Jugs;
+
+	JugsState initial, goal;
+	initial.jugs.push_back(Jug(3, 0)), initial.jugs.push_back(Jug(4, 0));
+	goal.jugs.push_back(Jug(3, 2)), goal.jugs.push_back(Jug(4, 0));
+
+	// 2L em qualquer das jarras
+	std::deque<JugsState> goals;
+	for(int v = 0; v <= goal.jugs[1].get_capacity(); ++v) {
+		goal.jugs[1].empty();
+		goal.jugs[1].put(v);
+		goals.push_back(goal);
+	}
+	goal.jugs[1] = Jug(4, 2);
+	for(int v = 0; v <= goal.jugs[0].get_capacity(); ++v) {
+		goal.jugs[0].empty();
+		goal.jugs[0].put(v);
+		goals.push_back(goal);
+	}
+
+	JugsProblem problem(initial, goals);
+	run_uninformed("Jugs", "3-4", problem);
+}
+
+void run_missionaries() {
+	using namespace Examples::Missionaries;
+
+	MissionariesState initial(Margin(3, 3, true), Margin(0, 0, false));
+	MissionariesState goal(Margin(0, 0, false), Margin(3, 3, true));
+
+	std::deque<MissionariesState> goals;
+	goals.push_back(goal);
+	goal.left.canoe = true, goal.right.canoe = false;
+	goals.push_back(goal);
+
+	MissionariesProblem problem(initial, goals);
+	run_uninformed("Missionaries", "3-3", problem);
+}
+/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
+} // unnamed namespace
+} // namespace Benchmark
+} // namespace IIA
+
+int main(int argc, char **argv) {
+	using namespace IIA::Benchmark;
+
+	const unsigned int max_depth = (argc > 1 ? atoi(argv[1]) : 24);
+
+	std::ofstream trace_file;
+	if(argc > 2) {
+		trace_file.open(argv[2]);
+		if(!trace_file) {
+			std::cerr << "Unable to open " << argv[2] << std::endl;
+			return 1;
+		}
+	}
+	IIA::Search::JsonLinesExporter trace_exporter(trace_file);
+	if(trace_file.is_open()) exporter = &trace_exporter;
+
+	parallel_workers.push_back(1);
+	if(IIA::Utils::ThreadPool::hardware_workers() > 1)
+		parallel_workers.push_back(IIA::Utils::ThreadPool::hardware_workers());
+
+	std::cout << "problem,instance,search,status,depth,cost,nodes,cpu_ns,nodes_per_sec,"
+				 "allocations,allocations_per_node,peak_bytes,wall_ns" << std::endl;
+	run_npuzzle(max_depth);
+	run_romania();
+	run_jugs();
+	run_missionaries();
+
+	return 0;
+}
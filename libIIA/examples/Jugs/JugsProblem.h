@@ -8,7 +8,8 @@
 #ifndef IIA_EXAMPLES_JUGS_PROBLEM_H
 #define IIA_EXAMPLES_JUGS_PROBLEM_H
 
-#include "Problem.hpp"
+#include "EncodedProblem.hpp"
+#include "JugsAction.h"
 #include "JugsState.h"
 
 namespace IIA {
@@ -17,38 +18,50 @@ namespace Examples {
 namespace Jugs {
 /** Define o problema. Dadas duas jarras com 3 e 4 litros de capacidade,
  * sem marcações de volume, e um reservatório infinito, como conseguir 2
- * litros em uma das jarras? */
-class JugsProblem : public IIA::Problem<JugsState> {
+ * litros em uma das jarras?
+ *
+ * Com @em n jarras, as ações são codificadas em blocos de @em n + 2 por jarra
+ * @em j: encher @em j, transferir de @em j para cada jarra @em k e esvaziar
+ * @em j (mesma ordem em que eram geradas como objetos Action). */
+class JugsProblem : public IIA::EncodedProblem<JugsState> {
 public:
 	/** Construtor. Inicializa o problema com um estado inicial e um objetivo. */
 	JugsProblem(const JugsState &state, const JugsState &goal) :
-	IIA::Problem<JugsState>(state, goal) {}
+	IIA::EncodedProblem<JugsState>(state, goal) { check_size(); }
 
 	/** Construtor. Inicializa o problema com um estado inicial e um conjunto de
 	 * objetivos. */
 	JugsProblem(const JugsState &state, const std::deque<JugsState> &goals):
-	IIA::Problem<JugsState>(state, goals) {}
+	IIA::EncodedProblem<JugsState>(state, goals) { check_size(); }
 
-	/** Define as acoes possiveis conforme o estado dado. */
-	std::deque<IIA::Action<JugsState> *> actions(const JugsState &state) const {
-		std::deque<IIA::Action<JugsState> *> actions;
+	/** Retorna o número de ações (codificadas) do problema. */
+	unsigned int num_actions() const {
+		return jugs() * (jugs() + 2);
+	}
 
-		for(unsigned int j = 0; j < state.jugs.size(); ++j) {
-			if(!(state.jugs[j].is_full())) {
-				//actions.push_back(new Put1(j));
-				actions.push_back(new Fill(j));
-			}
-			for(unsigned int k = 0; k < state.jugs.size(); ++k) {
-				if(j != k &&
-				   !(state.jugs[j].is_empty()) &&
-				   !(state.jugs[k].is_full()))
-					actions.push_back(new Transfer(j, k));
-			}
-			if(!(state.jugs[j].is_empty()))
-				actions.push_back(new Empty(j));
-		}
+	/** Indica se a ação identificada pode ser executada no estado dado. */
+	bool applicable(const JugsState &state, ActionId id) const {
+		unsigned int j = id / (jugs() + 2), slot = id % (jugs() + 2);
+		if(slot == 0) return !state.jugs[j].is_full();
+		if(slot == jugs() + 1) return !state.jugs[j].is_empty();
+		unsigned int k = slot - 1;
+		return j != k && !state.jugs[j].is_empty() && !state.jugs[k].is_full();
+	}
+
+	/** Executa a ação identificada no estado dado. */
+	void execute(JugsState &state, ActionId id) const {
+		unsigned int j = id / (jugs() + 2), slot = id % (jugs() + 2);
+		if(slot == 0) state.jugs[j].fill();
+		else if(slot == jugs() + 1) state.jugs[j].empty();
+		else Transfer(j, slot - 1).execute(state);
+	}
 
-		return actions;
+	/** Retorna uma nova instância da ação identificada. */
+	IIA::Action<JugsState> *decode(ActionId id) const {
+		unsigned int j = id / (jugs() + 2), slot = id % (jugs() + 2);
+		if(slot == 0) return new Fill(j);
+		if(slot == jugs() + 1) return new Empty(j);
+		return new Transfer(j, slot - 1);
 	}
 	
 	/** Define os possíveis pares estado/ação de modo que a ação aplicada ao 
@@ -82,6 +95,16 @@ public:
 
 		return pairs;
 	}
+
+private:
+	/** Retorna o número de jarras do problema. */
+	unsigned int jugs() const { return initial_state.jugs.size(); }
+
+	/** Verifica se as ações podem ser codificadas em um ActionId. */
+	void check_size() const {
+		if(num_actions() > 256)
+			throw std::invalid_argument("Too many jugs to encode actions.");
+	}
 };
 } // namespace Jugs
 } // namespace Examples
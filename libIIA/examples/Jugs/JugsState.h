@@ -9,6 +9,7 @@
  #define IIA_EXAMPLES_JUGS_STATE_H
 
 #include <deque>
+#include <functional> // std::hash
 
 #include "Utils.h"
 #include "Jug.h"
@@ -63,6 +64,23 @@ public:
 };
 } // namespace Jugs
 } // namespace Examples
+
+/** Especialização de StateHash para o problema das jarras. */
+template <>
+struct StateHash<Examples::Jugs::JugsState> {
+	/** Indica que há função de espalhamento para o estado. */
+	static const bool enabled = true;
+	/** Combina capacidade e volume de cada jarra. */
+	std::size_t operator()(const Examples::Jugs::JugsState &state) const {
+		std::hash<double> hash;
+		std::size_t seed = state.jugs.size();
+		for(const Examples::Jugs::Jug &jug : state.jugs) {
+			seed = Utils::hash_combine(seed, hash(jug.get_capacity()));
+			seed = Utils::hash_combine(seed, hash(jug.get_volume()));
+		}
+		return seed;
+	}
+};
 } // namespace IIA
 
 #endif /* IIA_EXAMPLES_JUGS_STATE_H */
@@ -52,16 +52,15 @@ public:
 		return true;
 	}
 
-	/** Indica se a instância é menor que o estado dado. */
+	/** Indica se a instância é menor que o estado dado (ordem lexicográfica,
+	 * para uso em std::set/std::map). */
 	bool operator<(const MissionariesState &that) const {
-		if(this == &that) return false;
-
-		if(this->left.missionaries - this->left.cannibals <
-		that.left.missionaries - that.left.cannibals) return false;
-		if(this->right.missionaries - this->right.cannibals <
-		that.right.missionaries - that.right.cannibals) return false;
-
-		return true;
+		if(this->left.missionaries != that.left.missionaries) return this->left.missionaries < that.left.missionaries;
+		if(this->left.cannibals != that.left.cannibals) return this->left.cannibals < that.left.cannibals;
+		if(this->left.canoe != that.left.canoe) return this->left.canoe < that.left.canoe;
+		if(this->right.missionaries != that.right.missionaries) return this->right.missionaries < that.right.missionaries;
+		if(this->right.cannibals != that.right.cannibals) return this->right.cannibals < that.right.cannibals;
+		return this->right.canoe < that.right.canoe;
 	}
 
 	/** Atribui a instância o estado dado. */
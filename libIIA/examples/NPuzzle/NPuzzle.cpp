@@ -3,27 +3,12 @@
 #include "examples.hpp"
 
 #include "HeuristicSearchNode.hpp"
+#include "NPuzzleHeuristics.h"
 #include "NPuzzleProblem.h"
 
 namespace IIA {
 namespace Examples {
 namespace NPuzzle {
-class ManhattanDistance : public IIA::Search::Informed::HeuristicCalc<NPuzzleState> {
-public:
-	ManhattanDistance(const std::set<NPuzzleState> *goal_states) : IIA::Search::Informed::HeuristicCalc<NPuzzleState>(goal_states) {}
-	double eval(const NPuzzleState &state) const {
-		double dist = 0;
-		for(unsigned int r = 0; r < state.size(); ++r) {
-			for(unsigned int c = 0; c < state.size(); ++c) {
-				Coord coord = state.find(r * state.size() + c);
-				// Manhattan distance
-				dist += abs(coord.row - r) + abs(coord.col - c);
-			}
-		}
-		return dist;
-	}
-};
-
 class WrongTiles : public IIA::Search::Informed::HeuristicCalc<NPuzzleState> {
 public:
 	WrongTiles(const std::set<NPuzzleState> *goal_states) : IIA::Search::Informed::HeuristicCalc<NPuzzleState>(goal_states) {}
@@ -54,9 +39,32 @@ public:
 } // namespace Examples
 } // namespace IIA
 
+/** Constrói e salva um banco de padrões para o tabuleiro ordenado de tamanho
+ * dado. Uso: NPuzzle pdb <N> <arquivo> <peça> [<peça> ...] */
+int build_pattern_database(int argc, char **argv) {
+	using namespace IIA::Examples::NPuzzle;
+
+	if(argc < 5) {
+		std::cerr << "Uso: " << argv[0] << " pdb <N> <arquivo> <peça> [<peça> ...]\n";
+		return 1;
+	}
+
+	std::vector<unsigned int> tiles;
+	for(int i = 4; i < argc; ++i) tiles.push_back(atoi(argv[i]));
+
+	PatternDatabase database(NPuzzleState(atoi(argv[2])), tiles);
+	database.save(argv[3]);
+	std::cout << argv[3] << ": " << database.entries() << " entradas\n";
+
+	return 0;
+}
+
 int main(int argc, char **argv) {
 	using namespace IIA::Examples::NPuzzle;
 
+	if(argc > 1 && std::string(argv[1]) == "pdb")
+		return build_pattern_database(argc, argv);
+
 	NPuzzleState initial(3), goal(3);
 
 	Right right;
@@ -72,6 +80,12 @@ int main(int argc, char **argv) {
 	IIA::Examples::run_uniformed_searches(problem);
 	IIA::Examples::run_informed_searches(problem, h_calc);
 
+	// bancos de padrões disjuntos {1, 2, 3, 4} e {5, 6, 7, 8}
+	AdditivePatternDatabase pdb(&(problem.goal_states));
+	pdb.add(new PatternDatabase(goal, std::vector<unsigned int>({1, 2, 3, 4})));
+	pdb.add(new PatternDatabase(goal, std::vector<unsigned int>({5, 6, 7, 8})));
+	IIA::Examples::time_search("AStar (pattern databases)", IIA::Search::Informed::AStar::search, problem, pdb);
+
 	return 0;
 }
 
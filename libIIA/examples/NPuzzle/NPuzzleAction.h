@@ -33,7 +33,7 @@ public:
 		Coord new_coord(old_coord.row + this->row, old_coord.col + this->col);
 		if(!state.is_valid(new_coord))
 			throw std::invalid_argument("Cannot execute N-Puzzle action.");
-		std::swap(state[old_coord], state[new_coord]);
+		state.move_blank(new_coord);
 	}
 };
 
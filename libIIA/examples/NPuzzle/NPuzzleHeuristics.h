@@ -0,0 +1,396 @@
+/** @file NPuzzleHeuristics.h
+ *
+ * Descreve heurísticas para o N-Puzzle.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date  10/2026 */
+
+#ifndef IIA_EXAMPLES_NPUZZLE_HEURISTICS_H
+#define IIA_EXAMPLES_NPUZZLE_HEURISTICS_H
+
+#include <cstdint>
+#include <cstdlib> // abs
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "HeuristicSearchNode.hpp"
+#include "NPuzzleState.h"
+
+namespace IIA {
+namespace Examples {
+namespace NPuzzle {
+/** Distância Manhattan: soma, para cada peça (exceto o vazio), das distâncias
+ * em linhas e colunas entre sua posição e a posição no objetivo. É admissível
+ * e consistente. Como cada movimento altera a posição de uma única peça,
+ * eval_successor atualiza a estimativa do pai em tempo constante. */
+class ManhattanDistance : public IIA::Search::Informed::HeuristicCalc<NPuzzleState> {
+public:
+	/** Construtor. O problema deve ter um único objetivo. */
+	ManhattanDistance(const std::set<NPuzzleState> *goal_states) :
+		IIA::Search::Informed::HeuristicCalc<NPuzzleState>(goal_states) {
+		if(goals->size() != 1)
+			throw std::invalid_argument("Manhattan distance requires a single goal.");
+
+		const NPuzzleState &goal = *(goals->begin());
+		goal_row.resize(goal.size() * goal.size());
+		goal_col.resize(goal.size() * goal.size());
+		Coord coord;
+		for(coord.row = 0; coord.row < int(goal.size()); ++coord.row)
+			for(coord.col = 0; coord.col < int(goal.size()); ++coord.col)
+				goal_row[goal[coord]] = coord.row, goal_col[goal[coord]] = coord.col;
+	}
+
+	/** Calcula a distância do estado dado. */
+	double eval(const NPuzzleState &state) const {
+		int dist = 0;
+		Coord coord;
+		for(coord.row = 0; coord.row < int(state.size()); ++coord.row)
+			for(coord.col = 0; coord.col < int(state.size()); ++coord.col)
+				if(state[coord]) dist += distance(state[coord], coord);
+		return dist;
+	}
+
+	/** Atualiza a distância do pai considerando apenas a peça movida (que
+	 * ocupa, no sucessor, a posição do vazio do pai). */
+	double eval_successor(const NPuzzleState &successor, const NPuzzleState &parent, double parent_h) const {
+		Coord from = successor.find(0), to = parent.find(0);
+		unsigned int tile = successor[to];
+		return parent_h - distance(tile, from) + distance(tile, to);
+	}
+
+private:
+	/** Retorna a distância da peça, na coordenada dada, à sua posição no objetivo. */
+	int distance(unsigned int tile, const Coord &coord) const {
+		return abs(coord.row - goal_row[tile]) + abs(coord.col - goal_col[tile]);
+	}
+
+	/** A posição de cada peça no objetivo. */
+	std::vector<int> goal_row, goal_col;
+};
+
+/** Banco de dados de padrões (@em pattern database). Armazena, para cada
+ * disposição das peças de um padrão (subconjunto das peças), o número mínimo
+ * de movimentos <b>destas peças</b> necessário para levá-las às suas posições
+ * no objetivo. Como apenas os movimentos das peças do padrão são contados,
+ * bancos de padrões disjuntos podem ser somados (AdditivePatternDatabase).
+ *
+ * O banco é construído por uma busca em largura retrógrada a partir do
+ * objetivo (offline, pois pode levar minutos para o 15-Puzzle), e pode ser
+ * salvo em arquivo e carregado via mmap. Cada entrada ocupa um byte, e as
+ * disposições são indexadas pela posição (ranking) da permutação parcial das
+ * casas ocupadas pelas peças, portanto um padrão de @em k peças em @em C
+ * casas tem C!/(C-k)! entradas (e.g. 57.657.600 para 7 peças no 15-Puzzle).
+ * Exige tabuleiros compactados (NPuzzleState::is_packed).
+ *
+ * Exemplo de uso:
+ * @code
+ * NPuzzleState goal(4);
+ * std::vector<unsigned int> tiles = {1, 2, 3, 4, 5, 6, 7};
+ * PatternDatabase(goal, tiles).save("15-puzzle-1-7.pdb");
+ * ...
+ * PatternDatabase *db = new PatternDatabase("15-puzzle-1-7.pdb");
+ * @endcode */
+class PatternDatabase {
+public:
+	/** Maior número de peças de um padrão. */
+	static const unsigned int MAX_TILES = 8;
+
+	/** Constrói o banco por busca em largura retrógrada.
+	 *
+	 * @param goal o estado objetivo.
+	 * @param pattern_tiles as peças do padrão (sem o vazio). */
+	PatternDatabase(const NPuzzleState &goal, const std::vector<unsigned int> &pattern_tiles) : mapped(false) {
+		if(!goal.is_packed())
+			throw std::invalid_argument("Pattern databases require N <= 4.");
+		if(pattern_tiles.empty() || pattern_tiles.size() > MAX_TILES)
+			throw std::invalid_argument("Pattern must have between 1 and 8 tiles.");
+
+		Header header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, magic(), sizeof(header.magic));
+		header.goal = goal.packed();
+		header.n = goal.size();
+		header.k = pattern_tiles.size();
+		for(unsigned int i = 0; i < pattern_tiles.size(); ++i) {
+			if(pattern_tiles[i] == 0 || pattern_tiles[i] >= goal.size() * goal.size())
+				throw std::invalid_argument("Invalid pattern tile.");
+			header.tiles[i] = pattern_tiles[i];
+		}
+
+		buffer.resize(sizeof(Header) + num_entries(header.n, header.k), uint8_t(UNKNOWN));
+		std::memcpy(&buffer[0], &header, sizeof(Header));
+		attach(&buffer[0], buffer.size());
+		build(goal);
+	}
+
+	/** Carrega o banco do arquivo dado, mapeando-o em memória (somente
+	 * leitura).
+	 *
+	 * @param path o caminho do arquivo. */
+	PatternDatabase(const std::string &path) : mapped(true) {
+		int fd = open(path.c_str(), O_RDONLY);
+		if(fd < 0)
+			throw std::runtime_error("Unable to open pattern database " + path);
+
+		struct stat info;
+		if(fstat(fd, &info) < 0 || std::size_t(info.st_size) < sizeof(Header)) {
+			close(fd);
+			throw std::runtime_error("Invalid pattern database " + path);
+		}
+
+		void *address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if(address == MAP_FAILED)
+			throw std::runtime_error("Unable to map pattern database " + path);
+
+		try {
+			attach(static_cast<const uint8_t *>(address), info.st_size);
+		} catch(...) {
+			munmap(address, info.st_size);
+			throw;
+		}
+	}
+
+	/** Destrutor. */
+	~PatternDatabase() {
+		if(mapped) munmap(const_cast<uint8_t *>(data), length);
+	}
+
+	/** Salva o banco no arquivo dado. */
+	void save(const std::string &path) const {
+		std::ofstream file(path.c_str(), std::ios::binary);
+		file.write(reinterpret_cast<const char *>(data), length);
+		if(!file)
+			throw std::runtime_error("Unable to write pattern database " + path);
+	}
+
+	/** Retorna o número mínimo de movimentos das peças do padrão para levá-las
+	 * do estado dado às suas posições no objetivo. */
+	unsigned int lookup(const NPuzzleState &state) const {
+		uint8_t cells[MAX_TILES];
+		uint64_t packed = state.packed();
+		for(unsigned int cell = 0; cell < num_cells; ++cell, packed >>= 4)
+			if(slot[packed & 0xF] >= 0) cells[slot[packed & 0xF]] = cell;
+		return table[rank(cells)];
+	}
+
+	/** Indica se a peça dada faz parte do padrão. */
+	bool contains(unsigned int tile) const { return tile < 16 && slot[tile] >= 0; }
+
+	/** Retorna o objetivo (compactado) para o qual o banco foi construído. */
+	uint64_t goal() const { return header()->goal; }
+
+	/** Retorna o número de entradas do banco. */
+	std::size_t entries() const { return num_entries(header()->n, header()->k); }
+
+private:
+	/** Cabeçalho do arquivo (48 bytes, seguido das entradas). */
+	struct Header {
+		char magic[8];
+		uint64_t goal;
+		uint8_t n, k;
+		uint8_t tiles[16];
+		uint8_t reserved[14];
+	};
+
+	/** Estado abstrato: casas das peças do padrão e do vazio. */
+	struct Abstract {
+		uint8_t cells[MAX_TILES];
+		uint8_t blank;
+		uint8_t cost;
+	};
+
+	/** Identifica arquivos de bancos de padrões. */
+	static const char *magic() { return "IIAPDB01"; }
+	/** Valor de entradas ainda não calculadas. */
+	static const uint8_t UNKNOWN = 0xFF;
+
+	/** Retorna o número de permutações parciais de k peças em n*n casas. */
+	static std::size_t num_entries(unsigned int n, unsigned int k) {
+		std::size_t entries = 1;
+		for(unsigned int i = 0; i < k; ++i) entries *= n * n - i;
+		return entries;
+	}
+
+	/** Valida o cabeçalho dos dados dados e prepara o acesso à tabela. */
+	void attach(const uint8_t *bytes, std::size_t size) {
+		data = bytes, length = size;
+		const Header *h = header();
+		if(std::memcmp(h->magic, magic(), sizeof(h->magic)) != 0 ||
+		   h->n < 2 || h->n > NPuzzleState::MAX_PACKED_SIZE || h->k < 1 || h->k > MAX_TILES ||
+		   size != sizeof(Header) + num_entries(h->n, h->k))
+			throw std::runtime_error("Invalid pattern database.");
+
+		num_cells = h->n * h->n;
+		num_tiles = h->k;
+		for(int &s : slot) s = -1;
+		for(unsigned int i = 0; i < num_tiles; ++i) {
+			if(h->tiles[i] == 0 || h->tiles[i] >= num_cells || slot[h->tiles[i]] >= 0)
+				throw std::runtime_error("Invalid pattern database.");
+			slot[h->tiles[i]] = i;
+		}
+		table = data + sizeof(Header);
+	}
+
+	/** Retorna o cabeçalho. */
+	const Header *header() const { return reinterpret_cast<const Header *>(data); }
+
+	/** Retorna o índice da disposição dada (casas das peças, na ordem do
+	 * padrão), i.e. sua posição entre as permutações parciais. */
+	std::size_t rank(const uint8_t *cells) const {
+		std::size_t index = 0;
+		uint32_t used = 0;
+		for(unsigned int i = 0; i < num_tiles; ++i) {
+			uint32_t smaller = used & ((1u << cells[i]) - 1);
+			index = index * (num_cells - i) + (cells[i] - __builtin_popcount(smaller));
+			used |= 1u << cells[i];
+		}
+		return index;
+	}
+
+	/** Preenche a tabela por busca em largura 0-1 a partir do objetivo: mover
+	 * o vazio para a casa de uma peça do padrão custa 1, e para uma casa livre
+	 * custa 0. Os movimentos são reversíveis, portanto a distância do objetivo
+	 * até uma disposição é igual à distância desta até o objetivo. */
+	void build(const NPuzzleState &goal) {
+		uint8_t *entries = &buffer[sizeof(Header)];
+		unsigned int n = goal.size();
+
+		Abstract start;
+		uint64_t packed = goal.packed();
+		for(unsigned int cell = 0; cell < num_cells; ++cell, packed >>= 4) {
+			if(slot[packed & 0xF] >= 0) start.cells[slot[packed & 0xF]] = cell;
+			else if((packed & 0xF) == 0) start.blank = cell;
+		}
+		start.cost = 0;
+
+		std::vector<bool> visited(num_entries(n, num_tiles) * num_cells, false);
+		std::deque<Abstract> queue(1, start);
+		while(!queue.empty()) {
+			Abstract current = queue.front();
+			queue.pop_front();
+
+			std::size_t index = rank(current.cells);
+			if(visited[index * num_cells + current.blank]) continue;
+			visited[index * num_cells + current.blank] = true;
+			if(entries[index] == UNKNOWN) entries[index] = current.cost;
+
+			static const int d_row[] = {0, 0, -1, 1}, d_col[] = {-1, 1, 0, 0};
+			int row = current.blank / n, col = current.blank % n;
+			for(unsigned int d = 0; d < 4; ++d) {
+				int r = row + d_row[d], c = col + d_col[d];
+				if(r < 0 || r >= int(n) || c < 0 || c >= int(n)) continue;
+
+				Abstract next = current;
+				next.blank = r * n + c;
+				int moved = -1;
+				for(unsigned int i = 0; i < num_tiles; ++i)
+					if(current.cells[i] == next.blank) moved = i;
+
+				if(moved < 0) {
+					if(!visited[index * num_cells + next.blank]) queue.push_front(next);
+				} else {
+					next.cells[moved] = current.blank;
+					++next.cost;
+					if(!visited[rank(next.cells) * num_cells + next.blank]) queue.push_back(next);
+				}
+			}
+		}
+	}
+
+	PatternDatabase(const PatternDatabase &);
+	PatternDatabase &operator= (const PatternDatabase &);
+
+	// Attributes
+	/** Dados (cabeçalho e tabela), em buffer ou mapeados em memória. */
+	const uint8_t *data;
+	/** Tamanho dos dados. */
+	std::size_t length;
+	/** Indica se os dados foram mapeados via mmap. */
+	bool mapped;
+	/** Dados construídos em memória. */
+	std::vector<uint8_t> buffer;
+	/** Início da tabela. */
+	const uint8_t *table;
+	/** Número de casas do tabuleiro e de peças do padrão. */
+	unsigned int num_cells, num_tiles;
+	/** A posição de cada peça no padrão (-1 se não fizer parte). */
+	int slot[16];
+};
+
+/** Heurística que soma bancos de padrões disjuntos (e.g. 7-8 para o
+ * 15-Puzzle). Como cada banco conta apenas os movimentos de suas peças, a soma
+ * é admissível. Após um movimento, apenas o banco que contém a peça movida é
+ * consultado novamente. */
+class AdditivePatternDatabase : public IIA::Search::Informed::HeuristicCalc<NPuzzleState> {
+public:
+	/** Construtor. O problema deve ter um único objetivo. */
+	AdditivePatternDatabase(const std::set<NPuzzleState> *goal_states) :
+		IIA::Search::Informed::HeuristicCalc<NPuzzleState>(goal_states) {
+		if(goals->size() != 1)
+			throw std::invalid_argument("Pattern databases require a single goal.");
+		if(!goals->begin()->is_packed())
+			throw std::invalid_argument("Pattern databases require N <= 4.");
+		for(int &d : database_of) d = -1;
+	}
+
+	/** Destrutor. */
+	~AdditivePatternDatabase() { Utils::empty(databases); }
+
+	/** Adiciona o banco dado, que passa a pertencer à instância. O banco deve
+	 * ter sido construído para o mesmo objetivo e ser disjunto dos demais. */
+	void add(PatternDatabase *database) {
+		if(database->goal() != goals->begin()->packed()) {
+			delete database;
+			throw std::invalid_argument("Pattern database built for another goal.");
+		}
+		for(unsigned int tile = 1; tile < 16; ++tile) {
+			if(database->contains(tile) && database_of[tile] >= 0) {
+				delete database;
+				throw std::invalid_argument("Pattern databases must be disjoint.");
+			}
+		}
+		for(unsigned int tile = 1; tile < 16; ++tile)
+			if(database->contains(tile)) database_of[tile] = databases.size();
+		databases.push_back(database);
+	}
+
+	/** Soma as estimativas de cada banco. */
+	double eval(const NPuzzleState &state) const {
+		unsigned int h = 0;
+		for(const PatternDatabase *database : databases)
+			h += database->lookup(state);
+		return h;
+	}
+
+	/** Atualiza a estimativa do pai consultando apenas o banco da peça movida. */
+	double eval_successor(const NPuzzleState &successor, const NPuzzleState &parent, double parent_h) const {
+		int d = database_of[successor[parent.find(0)]];
+		if(d < 0) return parent_h;
+		return parent_h - databases[d]->lookup(parent) + databases[d]->lookup(successor);
+	}
+
+private:
+	AdditivePatternDatabase(const AdditivePatternDatabase &);
+	AdditivePatternDatabase &operator= (const AdditivePatternDatabase &);
+
+	// Attributes
+	/** Os bancos de padrões. */
+	std::deque<PatternDatabase *> databases;
+	/** O banco que contém cada peça (-1 se nenhum). */
+	int database_of[16];
+};
+} // namespace NPuzzle
+} // namespace Examples
+} // namespace IIA
+
+#endif // IIA_EXAMPLES_NPUZZLE_HEURISTICS_H
@@ -8,35 +8,63 @@
 #ifndef IIA_EXAMPLES_NPUZZLE_PROBLEM_H
 #define IIA_EXAMPLES_NPUZZLE_PROBLEM_H
 
-#include "Problem.hpp"
+#include "EncodedProblem.hpp"
 #include "NPuzzleAction.h"
 
 namespace IIA {
 namespace Examples {
 namespace NPuzzle {
 /** Define o problema. Dado um tabuleiro, como movimentar as peças para que 
- * fiquem ordenadas? */
-class NPuzzleProblem : public IIA::Problem<NPuzzleState> {
+ * fiquem ordenadas?
+ *
+ * As ações são codificadas pela direção em que o espaço se move: 0 (esquerda),
+ * 1 (direita), 2 (cima) e 3 (baixo). */
+class NPuzzleProblem : public IIA::EncodedProblem<NPuzzleState> {
 public:
 	/** Construtor. */
 	NPuzzleProblem(const NPuzzleState &state, const NPuzzleState &goal)
-		: IIA::Problem<NPuzzleState>(state, goal) {}
+		: IIA::EncodedProblem<NPuzzleState>(state, goal) {}
 
-	/** Define as ações possíveis conforme o estado. */
-	std::deque<Action<NPuzzleState> *> actions(const NPuzzleState &state) const {
-		std::deque<IIA::Action<NPuzzleState> *> actions;
+	/** Retorna o número de ações (direções). */
+	unsigned int num_actions() const { return 4; }
 
-		Coord coord = state.find(0);
-		if(coord.col > 0)
-			actions.push_back(new Left());
-		if(coord.col < state.size() - 1)
-			actions.push_back(new Right());
-		if(coord.row > 0)
-			actions.push_back(new Up());
-		if(coord.row < state.size() - 1)
-			actions.push_back(new Down());
+	/** Indica se o espaço pode ser movido na direção dada. */
+	bool applicable(const NPuzzleState &state, ActionId id) const {
+		return state.is_valid(neighbour(state.find(0), id));
+	}
 
-		return actions;
+	/** Move o espaço na direção dada. */
+	void execute(NPuzzleState &state, ActionId id) const {
+		Coord coord = neighbour(state.find(0), id);
+		if(!state.is_valid(coord))
+			throw std::invalid_argument("Cannot execute N-Puzzle action.");
+		state.move_blank(coord);
+	}
+
+	/** Gera os sucessores do estado, localizando o espaço uma única vez e
+	 * desfazendo cada movimento após repassá-lo. */
+	void for_each_successor(const NPuzzleState &state, SuccessorSink<NPuzzleState> &sink) const {
+		NPuzzleState successor(state);
+		Coord blank = state.find(0);
+		for(unsigned int id = 0; id < num_actions(); ++id) {
+			Coord coord = neighbour(blank, id);
+			if(!state.is_valid(coord)) continue;
+			successor.move_blank(coord);
+			bool proceed = sink(successor, id, cost(id));
+			successor.move_blank(blank);
+			if(!proceed) return;
+		}
+	}
+
+	/** Retorna uma nova instância da ação de mover o espaço na direção dada. */
+	Action<NPuzzleState> *decode(ActionId id) const {
+		switch(id) {
+		case 0: return new Left();
+		case 1: return new Right();
+		case 2: return new Up();
+		case 3: return new Down();
+		}
+		throw std::out_of_range("Invalid N-Puzzle action id.");
 	}
 	
 	/** Define os possíveis pares estado/ação de modo que a ação aplicada ao 
@@ -72,6 +100,13 @@ public:
 
 		return pairs;
 	}
+
+private:
+	/** Retorna a coordenada vizinha na direção dada. */
+	static Coord neighbour(const Coord &coord, ActionId id) {
+		static const int d_row[] = {0, 0, -1, 1}, d_col[] = {-1, 1, 0, 0};
+		return Coord(coord.row + d_row[id], coord.col + d_col[id]);
+	}
 };
 } // namespace NPuzzle
 } // namespace Examples
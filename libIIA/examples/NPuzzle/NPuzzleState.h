@@ -8,11 +8,13 @@
 #ifndef IIA_EXAMPLES_NPUZZLE_STATE_H
 #define IIA_EXAMPLES_NPUZZLE_STATE_H
 
+#include <cstdint>
 #include <ostream>
 #include <stdexcept>
 #include <vector>
 
 #include "State.hpp"
+#include "Utils.h"
 
 namespace IIA {
 namespace Examples {
@@ -40,20 +42,68 @@ public:
 /** Define um estado para o problema do N-Puzzle. O estado é a representação do
  * tabuleiro, uma matriz de @em N linhas por @em N colunas em que cada célula
  * pode assumir um valor em [0, @em N - 1], representando a peça que está na casa
- * (0 é o "vazio"). */
+ * (0 é o "vazio").
+ *
+ * Se @em N <= MAX_PACKED_SIZE, o tabuleiro é compactado em uma única palavra
+ * de 64 bits, com 4 bits por casa, e comparação, ordenação, espalhamento e
+ * cópia são operações sobre a palavra. Tabuleiros maiores são armazenados em
+ * um vetor. Em ambos os casos, a posição do vazio é mantida à parte. */
 class NPuzzleState : public IIA::State<NPuzzleState> {
 public:
-	/** Construtor de um tabuleiro vazio. */
-	NPuzzleState(unsigned int size = 3) {
+	/** Maior tamanho de tabuleiro compactado em uma palavra. */
+	static const unsigned int MAX_PACKED_SIZE = 4;
+
+	/** Referência a uma casa do tabuleiro, que permite alterar sua peça. */
+	class Tile {
+	public:
+		/** Retorna a peça da casa. */
+		operator unsigned int() const { return state.get(i); }
+
+		/** Coloca a peça dada na casa. */
+		Tile &operator=(unsigned int number) {
+			state.set(i, number);
+			return *this;
+		}
+
+		/** Coloca na casa a peça da casa dada. */
+		Tile &operator=(const Tile &that) { return *this = static_cast<unsigned int>(that); }
+
+		/** Troca as peças das casas dadas. */
+		friend void swap(Tile a, Tile b) {
+			unsigned int number = a;
+			a = b, b = number;
+		}
+
+	private:
+		friend class NPuzzleState;
+		Tile(NPuzzleState &s, unsigned int index) : state(s), i(index) {}
+
+		// Attributes
+		NPuzzleState &state;
+		unsigned int i;
+	};
+
+	/** Construtor de um tabuleiro ordenado (vazio na primeira casa). */
+	NPuzzleState(unsigned int size = 3) : tiles(0), n(size), blank(0) {
 		if(size < 1)
 			throw std::invalid_argument("N-Puzzle must have N > 1.");
 
-		board.resize(size, std::vector<unsigned int>(size, 0));
-		for(unsigned int i = 0; i < board.size(); ++i) {
-			for(unsigned int j = 0; j < board[i].size(); ++j) {
-				board[i][j] = i * size + j;
-			}
-		}
+		if(!is_packed()) board.resize(size * size);
+		for(unsigned int i = 0; i < size * size; ++i)
+			set(i, i);
+	}
+
+	/** Construtor de cópia (o vetor só é copiado se o tabuleiro não estiver
+	 * compactado). */
+	NPuzzleState(const NPuzzleState &that) : tiles(that.tiles), n(that.n), blank(that.blank) {
+		if(!that.is_packed()) board = that.board;
+	}
+
+	/** Atribui à instância o objeto dado como argumento. */
+	NPuzzleState &operator= (const NPuzzleState &that) {
+		tiles = that.tiles, n = that.n, blank = that.blank;
+		if(!that.is_packed() || !board.empty()) board = that.board;
+		return *this;
 	}
 
 	/** Indica se a coordenada dada é válida, i.e. dentro dos limites de
@@ -61,8 +111,8 @@ public:
 	 *
 	 * @param coord a coordenada. */
 	bool is_valid(const Coord &coord) const {
-		if(0 > coord.row || coord.row >= board.size()) return false;
-		if(0 > coord.col || coord.col >= board.size()) return false;
+		if(0 > coord.row || coord.row >= int(n)) return false;
+		if(0 > coord.col || coord.col >= int(n)) return false;
 		return true;
 	}
 
@@ -73,69 +123,157 @@ public:
 	}
 
 	/** Converte o tabuleiro em uma string. */
-	//std::string to_string() const;
-	
 	friend std::ostream &operator <<(std::ostream &os, const NPuzzleState &state) {
-		for(std::vector<unsigned int> row :state.board)
+		Coord coord;
+		for(coord.row = 0; coord.row < int(state.n); ++coord.row) {
+			std::vector<unsigned int> row;
+			for(coord.col = 0; coord.col < int(state.n); ++coord.col)
+				row.push_back(state[coord]);
 			os << "\n" << Utils::String::join(row);
+		}
 		return os;
 	}
 
-	/** Acessa a marca da coordenada dada. */
-	unsigned int &operator[](const Coord &coord) {
-		return board[coord.row][coord.col];
+	/** Acessa a peça da coordenada dada. */
+	Tile operator[](const Coord &coord) {
+		return Tile(*this, index(coord));
+	}
+
+	/** Retorna a peça da coordenada dada. */
+	unsigned int operator[](const Coord &coord) const {
+		return get(index(coord));
 	}
 
-	/** Acessa a marca da coordenada dada. */
-	const unsigned int operator[](const Coord &coord) const {
-		return board[coord.row][coord.col];
+	/** Move o vazio para a coordenada dada (vizinha), trocando-o com a peça
+	 * que lá está. */
+	void move_blank(const Coord &coord) {
+		unsigned int from = blank_index(), to = index(coord);
+		if(is_packed()) {
+			uint64_t tile = (tiles >> (4 * to)) & 0xF;
+			tiles &= ~(uint64_t(0xF) << (4 * to));
+			tiles |= tile << (4 * from);
+		} else {
+			board[from] = board[to];
+			board[to] = 0;
+		}
+		blank = to;
 	}
 
 	/** Indica se a instância é igual ao objeto dado como argumento. */
 	bool operator==(const NPuzzleState &that) const {
-		if(this == &that) return true;
-		return this->board == that.board;
+		if(this->n != that.n || this->tiles != that.tiles) return false;
+		return is_packed() || this->board == that.board;
 	}
 
 	/** Indica se a instância é menor que objeto dado como argumento. */
 	bool operator<(const NPuzzleState &that) const {
-		if(this == &that) return false;
-		return this->board < that.board;
+		if(this->n != that.n) return this->n < that.n;
+		if(this->tiles != that.tiles) return this->tiles < that.tiles;
+		return !is_packed() && this->board < that.board;
 	}
 
-	/** Atribui à instância o objeto dado como argumento. */
-	NPuzzleState &operator= (const NPuzzleState &that) {
-		if(this != &that) {
-			this->board.assign(that.board.begin(), that.board.end());
-		}
+	/** Inica o tamanho do estado. */
+	unsigned int size() const {return n;}
 
-		return *this;
-	}
+	/** Indica se o tabuleiro está compactado em uma palavra. */
+	bool is_packed() const {return n <= MAX_PACKED_SIZE;}
 
-	/** Inica o tamanho do estado. */
-	unsigned int size() const {return board.size();}
+	/** Retorna o tabuleiro compactado (4 bits por casa, em ordem de linhas).
+	 *
+	 * @throws std::logic_error se o tabuleiro não estiver compactado. */
+	uint64_t packed() const {
+		if(!is_packed())
+			throw std::logic_error("N-Puzzle board is only packed for N <= 4.");
+		return tiles;
+	}
 
 	/** Busca a coordenada do número na instância. */
 	Coord find(unsigned int number) const {
-		if(number >= board.size()*board.size())
+		if(number >= n * n)
 			throw std::out_of_range("Number out of range.");
 
-		Coord coord;
-		for(coord.row = 0; coord.row < board.size(); ++coord.row)
-			for(coord.col = 0; coord.col < board.size(); ++coord.col)
-				if(board[coord.row][coord.col] == number)
-					return coord;
+		if(number == 0) {
+			unsigned int i = blank_index();
+			return Coord(i / n, i % n);
+		}
+		for(unsigned int i = 0; i < n * n; ++i)
+			if(get(i) == number)
+				return Coord(i / n, i % n);
 
 		/** @todo exceção decente em NPuzzle::NPuzzleState::size */
 		throw std::logic_error("Unable to find number in board");
 	}
 
 private:
-	/** Armazena o tabuleiro. */
-	std::vector< std::vector<unsigned int> > board;
+	/** Indica que a posição do vazio não é conhecida. */
+	static const unsigned int UNKNOWN_BLANK = ~0u;
+
+	/** Retorna o índice da casa da coordenada dada. */
+	unsigned int index(const Coord &coord) const {return coord.row * n + coord.col;}
+
+	/** Retorna a peça da casa de índice dado. */
+	unsigned int get(unsigned int i) const {
+		if(is_packed()) return (tiles >> (4 * i)) & 0xF;
+		return board[i];
+	}
+
+	/** Coloca a peça dada na casa de índice dado, mantendo a posição do
+	 * vazio. */
+	void set(unsigned int i, unsigned int number) {
+		if(number >= n * n)
+			throw std::out_of_range("Number out of range.");
+
+		if(is_packed()) {
+			tiles &= ~(uint64_t(0xF) << (4 * i));
+			tiles |= uint64_t(number) << (4 * i);
+		} else board[i] = number;
+
+		if(number == 0) blank = i;
+		else if(i == blank) blank = UNKNOWN_BLANK; // o vazio foi sobrescrito
+	}
+
+	/** Retorna o índice da casa vazia. */
+	unsigned int blank_index() const {
+		if(blank != UNKNOWN_BLANK) return blank;
+		for(unsigned int i = 0; i < n * n; ++i)
+			if(get(i) == 0) return i;
+		throw std::logic_error("Unable to find number in board");
+	}
+
+	/** Armazena o tabuleiro compactado, 4 bits por casa (N <= 4). */
+	uint64_t tiles;
+	/** Armazena o tabuleiro, em ordem de linhas (N > 4). */
+	std::vector<unsigned int> board;
+	/** O tamanho do tabuleiro. */
+	unsigned int n;
+	/** O índice da casa vazia (UNKNOWN_BLANK enquanto o tabuleiro é
+	 * alterado casa a casa). */
+	unsigned int blank;
 };
 } // namespace NPuzzle
 } // namespace Examples
+
+/** Especialização de StateHash para o N-Puzzle. */
+template <>
+struct StateHash<Examples::NPuzzle::NPuzzleState> {
+	/** Indica que há função de espalhamento para o estado. */
+	static const bool enabled = true;
+	/** Espalha os bits do tabuleiro compactado (multiplicação de Fibonacci).
+	 * Tabuleiros maiores são antes reduzidos a uma palavra, casa a casa. */
+	std::size_t operator()(const Examples::NPuzzle::NPuzzleState &state) const {
+		uint64_t h;
+		if(state.is_packed()) h = state.packed();
+		else {
+			h = state.size();
+			Examples::NPuzzle::Coord coord;
+			for(coord.row = 0; coord.row < int(state.size()); ++coord.row)
+				for(coord.col = 0; coord.col < int(state.size()); ++coord.col)
+					h = h * 31 + state[coord];
+		}
+		h *= 0x9E3779B97F4A7C15ULL;
+		return std::size_t(h ^ (h >> 32));
+	}
+};
 } // namespace IIA
 
 #endif // IIA_EXAMPLES_NPUZZLE_STATE_H
@@ -0,0 +1,296 @@
+/** @file TestNPuzzle.cpp
+ *
+ * Implementa testes para o estado, o problema e as heurísticas do N-Puzzle.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "AStarSearch.h"
+#include "NPuzzleHeuristics.h"
+#include "NPuzzleProblem.h"
+#include "RandomUtils.h"
+
+namespace IIA {
+namespace Examples {
+namespace NPuzzle {
+namespace Test {
+// Executa no estado dado uma ação aplicável aleatória.
+void random_move(const NPuzzleProblem &problem, NPuzzleState &state, IIA::Utils::Random::Generator &generator) {
+	IIA::ActionId id;
+	do id = generator() % problem.num_actions(); while(!problem.applicable(state, id));
+	problem.execute(state, id);
+}
+
+// Cria um arquivo temporário vazio.
+std::string temporary_file() {
+	char path[] = "/tmp/TestNPuzzleXXXXXX";
+	int fd = mkstemp(path);
+	assert(fd >= 0);
+	close(fd);
+	return path;
+}
+
+// Verifica que as peças do tabuleiro ordenado estão em ordem de linhas.
+void check_ordered(const NPuzzleState &state) {
+	Coord coord;
+	for(coord.row = 0; coord.row < int(state.size()); ++coord.row)
+		for(coord.col = 0; coord.col < int(state.size()); ++coord.col)
+			assert(state[coord] == coord.row * state.size() + coord.col);
+}
+
+void test_packing() {
+	for(unsigned int n = 1; n <= 6; ++n) {
+		NPuzzleState state(n);
+		check_ordered(state);
+		assert(state.is_packed() == (n <= NPuzzleState::MAX_PACKED_SIZE));
+	}
+
+	// 4 bits por casa, em ordem de linhas
+	NPuzzleState state(2);
+	assert(state.packed() == 0x3210);
+	state.move_blank(Coord(0, 1));
+	assert(state.packed() == 0x3201);
+	assert(state[Coord(0, 0)] == 1 && state[Coord(0, 1)] == 0);
+
+	try {
+		NPuzzleState(5).packed();
+		assert(false);
+	} catch(std::logic_error e) {}
+	try {
+		NPuzzleState(0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+}
+
+void test_tiles() {
+	for(unsigned int n = 3; n <= 5; ++n) {
+		NPuzzleState state(n);
+
+		// troca de peças pela referência às casas
+		Coord a(0, 1), b(n - 1, n - 1);
+		swap(state[a], state[b]);
+		assert(state[a] == n * n - 1 && state[b] == 1);
+		state[b] = state[a];
+		assert(state[b] == n * n - 1);
+
+		try {
+			state[a] = n * n;
+			assert(false);
+		} catch(std::out_of_range e) {}
+	}
+}
+
+void test_blank() {
+	for(unsigned int n = 3; n <= 5; ++n) {
+		NPuzzleState state(n);
+		assert(state.find(0).row == 0 && state.find(0).col == 0);
+
+		state.move_blank(Coord(1, 0));
+		assert(state.find(0).row == 1 && state.find(0).col == 0);
+		assert(state[Coord(0, 0)] == n);
+
+		// o vazio sobrescrito é procurado até ser recolocado
+		state[Coord(1, 0)] = 1;
+		assert(state.find(1).row == 0 && state.find(1).col == 1);
+		state[Coord(0, 1)] = 0;
+		assert(state.find(0).row == 0 && state.find(0).col == 1);
+
+		// o problema move o vazio como Move::execute
+		const NPuzzleState goal(n);
+		NPuzzleProblem problem(goal, goal);
+		NPuzzleState moved(n);
+		problem.execute(moved, 1); // direita
+		problem.execute(moved, 3); // baixo
+		assert(moved.find(0).row == 1 && moved.find(0).col == 1);
+
+		NPuzzleState acted(n);
+		Right().execute(acted);
+		Down().execute(acted);
+		assert(acted == moved);
+		try {
+			Up().execute(acted), Up().execute(acted);
+			assert(false);
+		} catch(std::invalid_argument e) {}
+	}
+}
+
+void test_equality_and_hash() {
+	IIA::StateHash<NPuzzleState> hash;
+	for(unsigned int n = 3; n <= 5; ++n) {
+		NPuzzleState a(n), b(n);
+		assert(a == b && !(a < b) && !(b < a));
+		assert(hash(a) == hash(b));
+
+		b.move_blank(Coord(0, 1));
+		assert(!(a == b) && (a < b) != (b < a));
+		assert(hash(a) != hash(b));
+
+		// o mesmo tabuleiro, obtido por caminhos diferentes
+		NPuzzleState c(n);
+		c[Coord(0, 0)] = 1;
+		c[Coord(0, 1)] = 0;
+		assert(b == c && hash(b) == hash(c));
+
+		std::set<NPuzzleState> states;
+		states.insert(a), states.insert(b), states.insert(c);
+		assert(states.size() == 2);
+	}
+
+	// tamanhos diferentes nunca são iguais
+	assert(!(NPuzzleState(3) == NPuzzleState(4)));
+	assert(NPuzzleState(4) < NPuzzleState(5));
+}
+
+void test_ManhattanDistance() {
+	for(unsigned int n = 3; n <= 5; ++n) {
+		const NPuzzleState goal(n);
+		NPuzzleProblem problem(goal, goal);
+		ManhattanDistance h_calc(&problem.goal_states);
+		assert(h_calc.eval(goal) == 0);
+
+		// a atualização incremental coincide com o cálculo completo
+		IIA::Utils::Random::Generator generator(n);
+		NPuzzleState state(goal);
+		double h = 0;
+		for(unsigned int step = 0; step < 2000; ++step) {
+			NPuzzleState next(state);
+			random_move(problem, next, generator);
+			h = h_calc.eval_successor(next, state, h);
+			assert(h == h_calc.eval(next));
+			state = next;
+		}
+	}
+}
+
+void test_PatternDatabase() {
+	const NPuzzleState goal(3);
+	NPuzzleProblem problem(goal, goal);
+	ManhattanDistance manhattan(&problem.goal_states);
+
+	// o banco de uma única peça é a distância Manhattan desta peça, então a
+	// soma dos bancos de todas as peças é a distância Manhattan
+	AdditivePatternDatabase singles(&problem.goal_states);
+	for(unsigned int tile = 1; tile < 9; ++tile) {
+		PatternDatabase *database = new PatternDatabase(goal, std::vector<unsigned int>(1, tile));
+		assert(database->entries() == 9);
+		singles.add(database);
+	}
+
+	std::vector<unsigned int> tiles = {1, 2, 3, 4};
+	PatternDatabase built(goal, tiles);
+	assert(built.entries() == 9 * 8 * 7 * 6);
+	assert(built.goal() == goal.packed());
+	assert(built.lookup(goal) == 0);
+
+	// salvo e carregado via mmap, o banco é o mesmo
+	std::string path = temporary_file();
+	built.save(path);
+	PatternDatabase loaded(path);
+	assert(loaded.entries() == built.entries() && loaded.goal() == built.goal());
+	for(unsigned int tile = 0; tile < 9; ++tile)
+		assert(loaded.contains(tile) == built.contains(tile));
+
+	IIA::Utils::Random::Generator generator;
+	NPuzzleState state(goal);
+	for(unsigned int step = 0; step < 5000; ++step) {
+		random_move(problem, state, generator);
+		assert(singles.eval(state) == manhattan.eval(state));
+		assert(loaded.lookup(state) == built.lookup(state));
+		assert(built.lookup(state) < 0xFF); // todas as disposições são alcançáveis
+	}
+
+	// arquivos truncados ou inexistentes
+	std::ifstream file(path.c_str(), std::ios::binary);
+	std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	std::ofstream(path.c_str(), std::ios::binary).write(bytes.data(), bytes.size() - 1);
+	try {
+		PatternDatabase truncated(path);
+		assert(false);
+	} catch(std::runtime_error e) {}
+	std::remove(path.c_str());
+
+	try {
+		PatternDatabase missing("/nonexistent/TestNPuzzle");
+		assert(false);
+	} catch(std::runtime_error e) {}
+
+	// bancos inválidos
+	try {
+		PatternDatabase(NPuzzleState(5), tiles);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+	try {
+		PatternDatabase(goal, std::vector<unsigned int>(1, 9));
+		assert(false);
+	} catch(std::invalid_argument e) {}
+	try {
+		singles.add(new PatternDatabase(goal, tiles)); // não disjunto
+		assert(false);
+	} catch(std::invalid_argument e) {}
+}
+
+void test_AdditivePatternDatabase() {
+	const NPuzzleState goal(3);
+	NPuzzleProblem moves(goal, goal);
+	std::vector<unsigned int> first = {1, 2, 3, 4}, second = {5, 6, 7, 8};
+
+	IIA::Utils::Random::Generator generator;
+	for(unsigned int instance = 0; instance < 20; ++instance) {
+		NPuzzleState initial(goal);
+		for(unsigned int step = 0; step < 4 + instance; ++step)
+			random_move(moves, initial, generator);
+
+		NPuzzleProblem problem(initial, goal);
+		ManhattanDistance manhattan(&problem.goal_states);
+		AdditivePatternDatabase h_calc(&problem.goal_states);
+		h_calc.add(new PatternDatabase(goal, first));
+		h_calc.add(new PatternDatabase(goal, second));
+
+		// h = 0 é admissível: A* encontra o custo ótimo
+		IIA::Search::Informed::HeuristicCalc<NPuzzleState> zero(&problem.goal_states);
+		IIA::Search::Result<NPuzzleState> result = IIA::Search::Informed::AStar::search(problem, zero);
+		assert(result.status == IIA::Search::Result<NPuzzleState>::SUCCESS);
+
+		const double h = h_calc.eval(initial);
+		assert(manhattan.eval(initial) <= h);
+		assert(h <= result.actions.size());
+
+		// a atualização incremental coincide com o cálculo completo
+		NPuzzleState state(initial);
+		double h_state = h;
+		for(IIA::Action<NPuzzleState> *action : result.actions) {
+			NPuzzleState next(state);
+			action->execute(next);
+			h_state = h_calc.eval_successor(next, state, h_state);
+			assert(h_state == h_calc.eval(next));
+			state = next;
+		}
+		assert(h_state == 0);
+	}
+}
+} // namespace Test
+} // namespace NPuzzle
+} // namespace Examples
+} // namespace IIA
+
+int main(int argc, char **argv) {
+	using namespace IIA::Examples::NPuzzle::Test;
+
+	test_packing();
+	test_tiles();
+	test_blank();
+	test_equality_and_hash();
+	test_ManhattanDistance();
+	test_PatternDatabase();
+	test_AdditivePatternDatabase();
+
+	return 0;
+}
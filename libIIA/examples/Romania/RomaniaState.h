@@ -8,6 +8,7 @@
 #ifndef IIA_EXAMPLES_ROMANIA_STATE_H
 #define IIA_EXAMPLES_ROMANIA_STATE_H
 
+#include <functional> // std::hash
 #include <string>
 
 #include "State.hpp"
@@ -48,6 +49,17 @@ public:
 };
 } // namespace Romania
 } // namespace Examples
+
+/** Especialização de StateHash para o problema da Romênia. */
+template <>
+struct StateHash<Examples::Romania::RomaniaState> {
+	/** Indica que há função de espalhamento para o estado. */
+	static const bool enabled = true;
+	/** Retorna o valor de espalhamento do nome da cidade. */
+	std::size_t operator()(const Examples::Romania::RomaniaState &state) const {
+		return std::hash<std::string>()(state.key);
+	}
+};
 } // namespace IIA
 
 #endif // IIA_EXAMPLES_ROMANIA_STATE_HPP
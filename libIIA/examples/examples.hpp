@@ -124,7 +124,9 @@ void run_informed_searches(IIA::Problem<state_t> &p  /**< [in] problema a ser re
 	std::cout << "\n\n\tInformed:";
 
 	using namespace IIA::Search::Informed;
+	time_search("AStar", AStar::search, p, h_calc);
 	time_search("BestFirst", BestFirst::search, p, h_calc);
+	time_search("IDAStar", IDAStar::search, p, h_calc);
 }
 
 
@@ -0,0 +1,116 @@
+/** @file EncodedProblem.hpp
+ *
+ * Definição de um problema cujas ações são codificadas por índices.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_ENCODED_PROBLEM_HPP
+#define IIA_ENCODED_PROBLEM_HPP
+
+#include <deque>
+
+#include "Problem.hpp"
+
+namespace IIA {
+/** Identificador compacto de uma ação (índice em [0, num_actions())). */
+typedef unsigned char ActionId;
+
+/** Recebe os sucessores gerados por EncodedProblem::for_each_successor. */
+template <class state_t>
+class SuccessorSink {
+public:
+	/** Destrutor. */
+	virtual ~SuccessorSink() {}
+
+	/** Recebe um sucessor. A referência ao estado só é válida durante a
+	 * chamada.
+	 *
+	 * @param successor o estado resultante da ação.
+	 * @param id o identificador da ação.
+	 * @param cost o custo da ação.
+	 *
+	 * @return false para interromper a geração de sucessores. */
+	virtual bool operator()(const state_t &successor, ActionId id, double cost) = 0;
+};
+
+/** Classe base para problemas cujas ações podem ser identificadas por um índice
+ * pequeno (e.g. as 4 direções do N-Puzzle). As buscas que reconhecem esta
+ * interface armazenam apenas o ActionId em cada nó, sem instanciar nem clonar
+ * objetos Action; estes são criados (decode) apenas para compor a solução.
+ *
+ * Exemplo de implementação:
+ * @code
+ * class ZeroToFour : public EncodedProblem<Integer> {
+ * public:
+ * 	...
+ * 	unsigned int num_actions() const { return 3; }
+ * 	bool applicable(const Integer &state, ActionId id) const { return true; }
+ * 	void execute(Integer &state, ActionId id) const {
+ * 		if(id == 2) state.number *= 2;
+ * 		else state.number += (id == 0 ? 1 : -1);
+ * 	}
+ * 	double cost(ActionId id) const { return (id == 2 ? 0.75 : 0.5); }
+ * 	Action<Integer> *decode(ActionId id) const {
+ * 		if(id == 2) return new Multiply(2);
+ * 		return new Add(id == 0 ? 1 : -1);
+ * 	}
+ * };
+ * @endcode */
+template <class state_t>
+class EncodedProblem : public Problem<state_t> {
+public:
+	/**  Cria uma nova instância do problema, definindo o estado inicial e o
+	 * objetivo. */
+	EncodedProblem(const state_t &initial, const state_t &goal) :
+		Problem<state_t>(initial, goal) {}
+
+	/**  Cria uma nova instância do problema, definindo o estado inicial e um
+	 * conjunto de possíveis objetivos. */
+	EncodedProblem(const state_t &initial, const std::deque<state_t> &goals) :
+		Problem<state_t>(initial, goals) {}
+
+	/** Retorna o número de ações distintas do problema (no máximo 256). */
+	virtual unsigned int num_actions() const = 0;
+
+	/** Indica se a ação identificada pode ser executada no estado dado. */
+	virtual bool applicable(const state_t &state, ActionId id) const = 0;
+
+	/** Executa a ação identificada no estado dado, alterando-o. */
+	virtual void execute(state_t &state, ActionId id) const = 0;
+
+	/** Retorna o custo da ação identificada. */
+	virtual double cost(ActionId id) const { return 1; }
+
+	/** Retorna uma nova instância da ação identificada. */
+	virtual Action<state_t> *decode(ActionId id) const = 0;
+
+	/** Gera os sucessores do estado dado, repassando-os a sink (na ordem dos
+	 * identificadores), sem alocar ações. A implementação padrão reutiliza um
+	 * único estado auxiliar; problemas podem especializá-la para, por exemplo,
+	 * alterar o estado e desfazer a alteração após cada sucessor.
+	 *
+	 * @param state o estado a ser expandido.
+	 * @param sink o receptor dos sucessores. */
+	virtual void for_each_successor(const state_t &state, SuccessorSink<state_t> &sink) const {
+		state_t successor(state);
+		for(unsigned int id = 0; id < num_actions(); ++id) {
+			if(!applicable(state, id)) continue;
+			successor = state;
+			execute(successor, id);
+			if(!sink(successor, id, cost(id))) return;
+		}
+	}
+
+	/** Define as ações que podem ser realizadas no estado dado como argumento,
+	 * decodificando as ações aplicáveis. */
+	std::deque<Action<state_t> *> actions(const state_t &state) const {
+		std::deque<Action<state_t> *> actions;
+		for(unsigned int id = 0; id < num_actions(); ++id)
+			if(applicable(state, id)) actions.push_back(decode(id));
+		return actions;
+	}
+};
+} // namespace IIA
+
+#endif // IIA_ENCODED_PROBLEM_HPP
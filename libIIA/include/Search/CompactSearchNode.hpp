@@ -0,0 +1,72 @@
+/** @file CompactSearchNode.hpp
+ *
+ * Definição de nós compactos para buscas em problemas codificados.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_COMPACT_NODE_HPP
+#define IIA_SEARCH_COMPACT_NODE_HPP
+
+#include "EncodedProblem.hpp"
+
+namespace IIA {
+namespace Search {
+/** Nó de uma árvore de busca em um EncodedProblem. Equivale a
+ * Uninformed::Node, mas armazena apenas o ActionId da ação que o gerou (em vez
+ * de uma cópia polimórfica da ação), e não tem métodos virtuais. */
+template <class state_t>
+struct CompactNode {
+	/** Construtor.
+	 *
+	 * @param s o estado representado pelo nó.
+	 * @param p nó que gerou esta instância.
+	 * @param id identificador da ação que gerou esta instância.
+	 * @param cost o custo do caminho até chegar a este estado.*/
+	CompactNode(const state_t &s, CompactNode *p = nullptr, ActionId id = 0, double cost = 0) :
+		state(s), parent(p), path_cost(cost), action(id) {}
+
+	// Attributes
+	/** Estado representado pelo nó. */
+	state_t state;
+	/** O nó que gerou esta instância (nulo na raiz). */
+	CompactNode *parent;
+	/** O custo do caminho até o estado deste nó. */
+	double path_cost;
+	/** A ação que gerou este nó (indefinida na raiz). */
+	ActionId action;
+};
+
+/** Nó compacto que armazena também a estimativa de custo até o objetivo. */
+template <class state_t>
+struct CompactHeuristicNode : public CompactNode<state_t> {
+	/** Construtor.
+	 *
+	 * @param s o estado representado pelo nó.
+	 * @param p nó que gerou esta instância.
+	 * @param id identificador da ação que gerou esta instância.
+	 * @param cost o custo do caminho até chegar a este estado.
+	 * @param heuristic_cost o custo estimado do estado dado até o objetivo. */
+	CompactHeuristicNode(const state_t &s, CompactHeuristicNode *p = nullptr, ActionId id = 0,
+						 double cost = 0, double heuristic_cost = 0) :
+		CompactNode<state_t>(s, p, id, cost), h_cost(heuristic_cost) {}
+
+	/** Retorna a soma de path_cost e h_cost. */
+	double f_cost() const { return this->path_cost + this->h_cost; }
+
+	// Attributes
+	/** O custo estimado do caminho deste nó até um estado objetivo. */
+	double h_cost;
+};
+
+/** Indica se o nó dado ou algum de seus ancestrais tem o estado dado. */
+template <class state_t>
+bool in_parent_node(const CompactNode<state_t> *parent, const state_t &state) {
+	while(parent && parent->state != state)
+		parent = parent->parent;
+	return (parent != nullptr);
+}
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_COMPACT_NODE_HPP
@@ -0,0 +1,90 @@
+/** @file ConcurrentStateSet.hpp
+ *
+ * Definição de um conjunto de estados que pode ser compartilhado entre
+ * <i>threads</i>.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_CONCURRENT_STATE_SET_HPP
+#define IIA_SEARCH_CONCURRENT_STATE_SET_HPP
+
+#include <cstddef> // std::size_t
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "State.hpp"
+
+namespace IIA {
+namespace Search {
+/** Conjunto de estados indexado por StateHash e dividido em partições
+ * (@em shards), cada uma protegida por seu próprio mutex. A partição de um
+ * estado é determinada pelo seu valor de espalhamento, de modo que
+ * <i>threads</i> que inserem estados diferentes raramente disputam o mesmo
+ * mutex.
+ *
+ * Exige StateHash definido para o estado.
+ *
+ * Exemplo de uso:
+ * @code
+ * ConcurrentStateSet<Integer> visited;
+ * if(visited.insert(child->state)) // primeira vez que o estado é visto
+ *     next.push_back(child);
+ * @endcode */
+template <class state_t>
+class ConcurrentStateSet {
+	static_assert(StateHash<state_t>::enabled, "ConcurrentStateSet requires StateHash for the state type.");
+
+public:
+	/** Construtor.
+	 *
+	 * @param num_shards número de partições (> 0). */
+	explicit ConcurrentStateSet(std::size_t num_shards = 64) : shards(num_shards) {
+		if(num_shards == 0)
+			throw std::invalid_argument("ConcurrentStateSet must have at least one shard.");
+	}
+
+	/** Insere o estado dado, retornando verdadeiro se ele ainda não estava no
+	 * conjunto. */
+	bool insert(const state_t &state) {
+		Shard &shard = shards[spread_hash(hash(state)) % shards.size()];
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		return shard.states.insert(state).second;
+	}
+
+	/** Verifica se o estado dado está no conjunto. */
+	bool contains(const state_t &state) const {
+		const Shard &shard = shards[spread_hash(hash(state)) % shards.size()];
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		return shard.states.count(state) > 0;
+	}
+
+	/** Retorna o número de estados no conjunto (não deve ser chamado durante
+	 * inserções concorrentes). */
+	std::size_t size() const {
+		std::size_t n = 0;
+		for(const Shard &shard : shards) n += shard.states.size();
+		return n;
+	}
+
+private:
+	struct Shard {
+		mutable std::mutex mutex;
+		std::unordered_set<state_t, StateHash<state_t> > states;
+	};
+
+	ConcurrentStateSet(const ConcurrentStateSet &);
+	ConcurrentStateSet &operator=(const ConcurrentStateSet &);
+
+	// Attributes
+	StateHash<state_t> hash;
+	std::vector<Shard> shards;
+};
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_CONCURRENT_STATE_SET_HPP
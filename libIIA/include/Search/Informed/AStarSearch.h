@@ -0,0 +1,223 @@
+/** @file AStarSearch.h
+ *
+ * Definição do algoritmo de busca com informação A*.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_INFORMED_A_STAR_H
+#define IIA_SEARCH_INFORMED_A_STAR_H
+
+#include <deque>
+
+#include "NodeExpander.hpp"
+#include "Problem.hpp"
+#include "PriorityFrontier.hpp"
+#include "SearchObserver.hpp"
+#include "SearchResult.hpp"
+#include "Informed/HeuristicSearchNode.hpp"
+
+namespace IIA {
+namespace Search {
+namespace Informed {
+/** Implementação da busca A* (<a href="http://en.wikipedia.org/wiki/A*_search_algorithm">A-estrela</a>)
+ * em grafo. Ela explora o grafo selecionando o nó de menor custo estimado
+ * f(n) = g(n) + h(n), sendo g(n) o custo do caminho até o nó e h(n) a
+ * estimativa do nó até o objetivo. Se a heurística for admissível, a solução
+ * encontrada é ótima.
+ *
+ * A lista aberta é uma PriorityFrontier (heap indexado por estado) e a lista
+ * fechada é indexada por StateHash (se houver), portanto não há recursão nem
+ * reexpansão exponencial de nós, como em BestFirst::RBFS. Se um estado já
+ * fechado for alcançado por um caminho de menor custo (heurística
+ * inconsistente), ele é reaberto. Os nós são criados em uma NodeArena, liberada
+ * ao final da busca. */
+namespace AStar {
+/** Define o critério de desempate entre nós de mesmo f(n). */
+enum TieBreaking {
+	HIGHER_G,	/**< Prefere o nó de maior g(n) (mais próximo do objetivo). */
+	LOWER_G 	/**< Prefere o nó de menor g(n). */
+};
+
+/** Contadores de uma execução da busca. */
+struct Counters {
+	/** Construtor. */
+	Counters() : expanded_nodes(0), generated_nodes(0), updated_nodes(0), reopened_nodes(0) {}
+
+	/** Número de nós retirados da lista aberta e expandidos. */
+	long unsigned int expanded_nodes;
+	/** Número de nós gerados (filhos). */
+	long unsigned int generated_nodes;
+	/** Número de nós da lista aberta cujo custo foi reduzido. */
+	long unsigned int updated_nodes;
+	/** Número de nós fechados que foram reabertos. */
+	long unsigned int reopened_nodes;
+};
+
+namespace { // unnamed
+// Compara os nós, indicando se o primeiro tem menor prioridade que o segundo
+// (maior f ou, em caso de empate, conforme o critério de desempate).
+template <class node_t>
+class FCostComparison {
+public:
+	FCostComparison(TieBreaking tb = HIGHER_G) : tie_breaking(tb) {}
+
+	bool operator()(const node_t *lhs, const node_t *rhs) const {
+		if(lhs->f_cost() != rhs->f_cost())
+			return (lhs->f_cost() > rhs->f_cost());
+		if(tie_breaking == HIGHER_G)
+			return (lhs->path_cost < rhs->path_cost);
+		return (lhs->path_cost > rhs->path_cost);
+	}
+
+private:
+	TieBreaking tie_breaking;
+};
+
+// Busca com o gerador de nós dado (ActionExpander ou EncodedExpander).
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> search_with(const Problem<state_t> &problem,
+							const expander_t &expander,
+							TieBreaking tie_breaking,
+							long unsigned int max_nodes,
+							Counters *counters,
+							observer_t &observer) {
+	typedef typename expander_t::node_type node_t;
+
+	Counters count;
+	PriorityFrontier<state_t, node_t, FCostComparison<node_t> > open((FCostComparison<node_t>(tie_breaking)));
+	typename StateMap<state_t, node_t *>::type closed;
+	NodeArena<node_t> arena; // todos os nós gerados
+
+	open.push(expander.root(arena));
+
+	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
+	while(!open.empty()) {
+		if(max_nodes && open.size() + closed.size() > max_nodes) {
+			result.status = Result<state_t>::CUTOFF;
+			break;
+		}
+
+		observer.begin(SELECTION);
+		node_t *node = open.pop();
+		closed[node->state] = node;
+		observer.end(SELECTION);
+
+		observer.begin(GOAL_TEST);
+		const bool goal = problem.is_goal(node->state);
+		observer.end(GOAL_TEST);
+		if(goal) {
+			result = expander.result(Result<state_t>::SUCCESS, node, result.expanded_nodes);
+			break;
+		}
+
+		++count.expanded_nodes;
+		observer.begin(EXPANSION), observer.expanded();
+		expander.expand(node, arena, [&](node_t *child) -> bool {
+			++result.expanded_nodes, ++count.generated_nodes, observer.generated();
+
+			typename StateMap<state_t, node_t *>::type::iterator it = closed.find(child->state);
+			if(it != closed.end()) {
+				if(child->path_cost < it->second->path_cost) {
+					closed.erase(it);
+					open.push(child);
+					++count.reopened_nodes, observer.reopened();
+				} else arena.release(child), observer.pruned();
+				return true;
+			}
+
+			node_t *aux_node = open.find(child->state);
+			if(!aux_node)
+				open.push(child);
+			else if(child->path_cost < aux_node->path_cost) {
+				arena.release(open.replace(child));
+				++count.updated_nodes;
+			} else
+				arena.release(child), observer.pruned();
+			return true;
+		});
+		observer.end(EXPANSION);
+		observer.frontier(open.size()), observer.memory(arena.size() * sizeof(node_t));
+	}
+
+	if(counters) *counters = count;
+
+	return result;
+}
+} // unnamed namespace
+
+/** Busca a solução do problema, como search(const Problem<state_t> &, const
+ * HeuristicCalc<state_t> &, TieBreaking, long unsigned int, Counters *),
+ * informando os eventos da busca ao observador dado (ex: SearchStats).
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ * @param observer [out] o observador da busca.
+ * @param tie_breaking o critério de desempate entre nós de mesmo f(n).
+ * @param max_nodes número máximo de nós armazenados simultaneamente (zero
+ * indica que não há limite).
+ * @param counters [out] se fornecido, armazena os contadores da busca.
+ *
+ * @return IIA::Search::Result o resultado da busca. */
+template <class state_t, class observer_t>
+Result<state_t> search(const Problem<state_t> &problem,
+					   const HeuristicCalc<state_t> &h_calc,
+					   observer_t &observer,
+					   TieBreaking tie_breaking = HIGHER_G,
+					   long unsigned int max_nodes = 0,
+					   Counters *counters = nullptr) {
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return search_with(problem, EncodedExpander<state_t, CompactHeuristicNode<state_t> >(*encoded_problem, &h_calc),
+						   tie_breaking, max_nodes, counters, observer);
+	return search_with(problem, ActionExpander<state_t, HeuristicNode<state_t> >(problem, &h_calc),
+					   tie_breaking, max_nodes, counters, observer);
+}
+
+/** Busca a solução do problema. Se o problema for um EncodedProblem, os nós
+ * armazenam apenas o identificador da ação (CompactHeuristicNode).
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ * @param tie_breaking o critério de desempate entre nós de mesmo f(n).
+ * @param max_nodes número máximo de nós armazenados simultaneamente (listas
+ * aberta e fechada); se excedido, a busca é interrompida (CUTOFF). Zero indica
+ * que não há limite.
+ * @param counters [out] se fornecido, armazena os contadores da busca.
+ *
+ * @return IIA::Search::Result o resultado da busca. */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem,
+					   const HeuristicCalc<state_t> &h_calc,
+					   TieBreaking tie_breaking,
+					   long unsigned int max_nodes = 0,
+					   Counters *counters = nullptr) {
+	NullObserver observer;
+	return search(problem, h_calc, observer, tie_breaking, max_nodes, counters);
+}
+
+/** Busca a solução do problema, desempatando nós de mesmo f(n) pelo maior
+ * g(n), sem limite de memória.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ *
+ * @return IIA::Search::Result o resultado da busca.
+ *
+ * Exemplo de uso:
+ * @code
+ * using namespace IIA::Search;
+ *
+ * ZeroToFour problem;
+ * Informed::HeuristicCalc<Integer> h_calc(&problem.goal_states);
+ * Result<Integer> result = Informed::AStar::search(problem, h_calc);
+ * @endcode */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem, const HeuristicCalc<state_t> &h_calc) {
+	return search(problem, h_calc, HIGHER_G);
+}
+} // namespace AStar
+} // namespace Informed
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_INFORMED_A_STAR_H
@@ -9,7 +9,10 @@
 #define IIA_SEARCH_INFORMED_BEST_FIRST_H
 
 #include <limits>
+#include <vector>
 
+#include "CompactSearchNode.hpp"
+#include "NodeExpander.hpp"
 #include "Problem.hpp"
 #include "SearchResult.hpp"
 #include "Informed/HeuristicSearchNode.hpp"
@@ -97,9 +100,95 @@ Result<state_t> RBFS(const Problem<state_t> &problem,
 
 	return result;
 }
+
+// Armazena os sucessores de um nó de um EncodedProblem que não estão no
+// caminho até ele.
+template <class state_t>
+class Successors : public SuccessorSink<state_t> {
+public:
+	Successors(CompactHeuristicNode<state_t> *p, const HeuristicCalc<state_t> &h,
+			   std::vector<CompactHeuristicNode<state_t> > &s) :
+		generated(0), parent(p), h_calc(h), successors(s) {}
+
+	bool operator()(const state_t &successor, ActionId id, double cost) {
+		++generated;
+		if(!in_parent_node(parent, successor))
+			successors.push_back(CompactHeuristicNode<state_t>(successor, parent, id, parent->path_cost + cost,
+															   h_calc.eval(successor)));
+		return true;
+	}
+
+	// Attributes
+	long unsigned int generated;
+
+private:
+	CompactHeuristicNode<state_t> *parent;
+	const HeuristicCalc<state_t> &h_calc;
+	std::vector<CompactHeuristicNode<state_t> > &successors;
+};
+
+/* O mesmo que RBFS, para um EncodedProblem: os sucessores são gerados por
+ * EncodedProblem::for_each_successor e armazenados por valor, sem alocação de
+ * ações. */
+template <class state_t>
+Result<state_t> RBFS(const EncodedProblem<state_t> &problem,
+					 CompactHeuristicNode<state_t> *node,
+					 const HeuristicCalc<state_t> &h_calc,
+					 double &f_limit) {
+	if(problem.is_goal(node->state))
+		return Result<state_t>(Result<state_t>::SUCCESS, node, problem, 0);
+
+	std::vector<CompactHeuristicNode<state_t> > successors;
+	Successors<state_t> sink(node, h_calc, successors);
+	problem.for_each_successor(node->state, sink);
+	const long unsigned int expanded_nodes = sink.generated;
+
+	if(successors.empty()) {
+		f_limit = std::numeric_limits<double>::max();
+		return Result<state_t>(Result<state_t>::FAILURE, nullptr, expanded_nodes);
+	}
+
+	// update f with value from previous search, if any
+	for(CompactHeuristicNode<state_t> &successor : successors) {
+		if(successor.f_cost() < node->f_cost()) {
+			successor.path_cost = node->path_cost;
+			successor.h_cost = node->h_cost;
+		}
+	}
+
+	Result<state_t> result(Result<state_t>::FAILURE);
+	while(true) {
+		CompactHeuristicNode<state_t> *best = &successors.front();
+		double alternative = std::numeric_limits<double>::infinity();
+		for(CompactHeuristicNode<state_t> &successor : successors) {
+			if(best->f_cost() > successor.f_cost())
+				best = &successor;
+			else if(alternative > successor.f_cost())
+				alternative = successor.f_cost();
+		}
+
+		if(best->f_cost() > f_limit) {
+			f_limit = best->f_cost();
+			result = Result<state_t>(Result<state_t>::FAILURE, nullptr, expanded_nodes);
+			break;
+		}
+
+		f_limit = std::min(f_limit, alternative);
+		result = RBFS(problem, best, h_calc, f_limit);
+		result.expanded_nodes += expanded_nodes;
+		best->h_cost = f_limit - best->path_cost; // best->f_cost = f_limit
+
+		if(result.status != Result<state_t>::FAILURE)
+			break;
+	}
+
+	return result;
+}
 } // unnamed namespace
 
-/** Busca a solução do problema aumentando iterativamente a profundidade.
+/** Busca a solução do problema aumentando iterativamente a profundidade. Se o
+ * problema for um EncodedProblem, os sucessores são gerados por
+ * EncodedProblem::for_each_successor, sem alocação de ações.
  *
  * @param problem o problema a ser solucionado.
  * @param h_calc funçãoo que estiva o custo do nó até o objetivo.
@@ -116,6 +205,11 @@ Result<state_t> RBFS(const Problem<state_t> &problem,
 template <class state_t>
 Result<state_t> search(const Problem<state_t> &problem, const HeuristicCalc<state_t> &h_calc, double limit) {
 	double f_limit = limit;
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem)) {
+		CompactHeuristicNode<state_t> root(problem.initial_state, nullptr, 0, 0, h_calc.eval(problem.initial_state));
+		return RBFS(*encoded_problem, &root, h_calc, f_limit);
+	}
+
 	HeuristicNode<state_t> *node = new HeuristicNode<state_t>(problem.initial_state, nullptr, nullptr, 0, h_calc.eval(problem.initial_state));
 	Result<state_t> result = RBFS<state_t>(problem, node, h_calc, f_limit);
 	delete node;
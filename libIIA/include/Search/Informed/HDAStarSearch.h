@@ -0,0 +1,267 @@
+/** @file HDAStarSearch.h
+ *
+ * Definição do algoritmo de busca com informação HDA* (A* paralelo com
+ * distribuição dos estados por espalhamento).
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_INFORMED_HDA_STAR_H
+#define IIA_SEARCH_INFORMED_HDA_STAR_H
+
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Mailbox.h"
+#include "NodeExpander.hpp"
+#include "Problem.hpp"
+#include "PriorityFrontier.hpp"
+#include "SearchResult.hpp"
+#include "ThreadPool.h"
+#include "Informed/AStarSearch.h"
+#include "Informed/HeuristicSearchNode.hpp"
+
+namespace IIA {
+namespace Search {
+namespace Informed {
+/** Implementação da busca HDA* (<i>Hash Distributed A*</i>), que executa A*
+ * em várias <i>threads</i> simultaneamente. Cada estado pertence a uma única
+ * <i>thread</i>, determinada pelo seu valor de StateHash; cada <i>thread</i>
+ * mantém as listas aberta e fechada dos seus estados e envia os filhos que
+ * gera às <i>threads</i> donas, em lotes, por caixas de mensagens sem travas
+ * (IIA::Utils::Mailbox).
+ *
+ * Ao encontrar um objetivo, a busca não termina imediatamente: os nós cujo
+ * f(n) não é menor que o custo da melhor solução são descartados, e a busca
+ * termina quando não há mais nós a expandir nem mensagens em trânsito. Assim,
+ * se a heurística for admissível, a solução encontrada é ótima (o caminho, se
+ * houver mais de um de mesmo custo, pode variar entre execuções).
+ *
+ * O problema e a heurística são usados simultaneamente por todas as
+ * <i>threads</i>, portanto seus métodos constantes não podem alterar estado
+ * compartilhado. */
+namespace HDAStar {
+namespace { // unnamed
+// Número de nós acumulados para uma thread antes do envio do lote.
+const std::size_t BATCH_SIZE = 64;
+// Número de expansões entre envios de todos os lotes pendentes.
+const unsigned int FLUSH_PERIOD = 256;
+
+// Busca com o gerador de nós dado (ActionExpander ou EncodedExpander).
+//
+// Detecção de término: <i>work</i> conta as threads ativas (com lista aberta
+// não vazia) mais os lotes em trânsito. Um lote só é enviado por uma thread
+// ativa, e quem o recebe se declara ativa antes de descontá-lo, então a
+// contagem só chega a zero quando não há mais trabalho algum.
+template <class state_t, class expander_t>
+Result<state_t> search_with(const Problem<state_t> &problem, const expander_t &expander,
+							unsigned int num_workers, AStar::Counters *counters) {
+	typedef typename expander_t::node_type node_t;
+	typedef std::vector<node_t *> batch_t;
+
+	struct Worker {
+		Worker() : open(AStar::FCostComparison<node_t>(AStar::HIGHER_G)) {}
+
+		NodeArena<node_t> arena; // nós gerados pela thread
+		PriorityFrontier<state_t, node_t, AStar::FCostComparison<node_t> > open;
+		typename StateMap<state_t, node_t *>::type closed;
+		Utils::Mailbox<batch_t> inbox;
+		std::vector<batch_t> outbox;
+		AStar::Counters count;
+	};
+
+	Utils::ThreadPool pool(num_workers);
+	std::deque<Worker> workers(num_workers);
+
+	StateHash<state_t> hash;
+	auto owner = [&](const state_t &state) -> unsigned int { return spread_hash(hash(state)) % num_workers; };
+
+	std::atomic<long> work(1);
+	std::atomic<bool> aborted(false);
+	std::atomic<double> best_cost(std::numeric_limits<double>::infinity());
+	std::mutex goal_mutex;
+	node_t *goal = nullptr;
+
+	Worker &first = workers[owner(problem.initial_state)];
+	first.open.push(expander.root(first.arena));
+
+	for(unsigned int w = 0; w < num_workers; ++w) {
+		pool.submit([&, w]() {
+			Worker &self = workers[w];
+			self.outbox.resize(num_workers);
+			bool active = (&self == &first);
+
+			// Insere o nó nas listas da thread, como em A* (reabre estados
+			// fechados alcançados por caminhos de menor custo).
+			auto insert = [&](node_t *node) {
+				if(node->f_cost() >= best_cost.load()) {
+					self.arena.release(node); // apenas se for da arena da thread
+					return;
+				}
+
+				typename StateMap<state_t, node_t *>::type::iterator it = self.closed.find(node->state);
+				if(it != self.closed.end()) {
+					if(node->path_cost < it->second->path_cost) {
+						self.closed.erase(it);
+						self.open.push(node);
+						++self.count.reopened_nodes;
+					} else self.arena.release(node);
+					return;
+				}
+
+				node_t *aux_node = self.open.find(node->state);
+				if(!aux_node)
+					self.open.push(node);
+				else if(node->path_cost < aux_node->path_cost) {
+					self.arena.release(self.open.replace(node));
+					++self.count.updated_nodes;
+				} else
+					self.arena.release(node);
+			};
+
+			auto send = [&](unsigned int to) {
+				++work;
+				workers[to].inbox.send(std::move(self.outbox[to]));
+				self.outbox[to] = batch_t();
+				self.outbox[to].reserve(BATCH_SIZE);
+			};
+
+			auto flush = [&]() {
+				for(unsigned int to = 0; to < num_workers; ++to)
+					if(!self.outbox[to].empty()) send(to);
+			};
+
+			try {
+				unsigned int expansions = 0;
+				while(!aborted.load()) {
+					self.inbox.receive([&](batch_t &batch) {
+						if(!active) ++work, active = true; // antes de descontar o lote
+						for(node_t *node : batch) insert(node);
+						--work;
+					});
+
+					if(self.open.empty() || self.open.top()->f_cost() >= best_cost.load()) {
+						self.open.clear(); // nada a expandir com f(n) menor que a solução
+						flush();
+						if(active) --work, active = false;
+						if(work.load() == 0) break;
+						std::this_thread::yield();
+						continue;
+					}
+
+					node_t *node = self.open.pop();
+					self.closed[node->state] = node;
+
+					if(problem.is_goal(node->state)) {
+						std::lock_guard<std::mutex> lock(goal_mutex);
+						if(node->path_cost < best_cost.load()) {
+							goal = node;
+							best_cost.store(node->path_cost);
+						}
+						continue;
+					}
+
+					++self.count.expanded_nodes;
+					expander.expand(node, self.arena, [&](node_t *child) -> bool {
+						++self.count.generated_nodes;
+
+						const unsigned int to = owner(child->state);
+						if(&workers[to] == &self)
+							insert(child);
+						else if(child->f_cost() >= best_cost.load())
+							self.arena.release(child);
+						else {
+							self.outbox[to].push_back(child);
+							if(self.outbox[to].size() >= BATCH_SIZE) send(to);
+						}
+						return true;
+					});
+
+					if(++expansions == FLUSH_PERIOD) flush(), expansions = 0;
+				}
+			} catch(...) {
+				aborted.store(true);
+				throw;
+			}
+		});
+	}
+	pool.wait();
+
+	AStar::Counters count;
+	for(const Worker &worker : workers) {
+		count.expanded_nodes += worker.count.expanded_nodes;
+		count.generated_nodes += worker.count.generated_nodes;
+		count.updated_nodes += worker.count.updated_nodes;
+		count.reopened_nodes += worker.count.reopened_nodes;
+	}
+	if(counters) *counters = count;
+
+	if(goal) return expander.result(Result<state_t>::SUCCESS, goal, count.generated_nodes + 1);
+	return Result<state_t>(Result<state_t>::FAILURE, nullptr, count.generated_nodes + 1);
+}
+
+// Seleciona a implementação conforme a existência de StateHash para o estado:
+// sem ele não há como distribuir os estados, e a busca é o A* sequencial.
+template <class state_t, class expander_t>
+Result<state_t> search_with(const Problem<state_t> &problem, const expander_t &expander,
+							unsigned int num_workers, AStar::Counters *counters, std::true_type) {
+	return search_with(problem, expander, num_workers, counters);
+}
+
+template <class state_t, class expander_t>
+Result<state_t> search_with(const Problem<state_t> &problem, const expander_t &expander,
+							unsigned int num_workers, AStar::Counters *counters, std::false_type) {
+	NullObserver observer;
+	return AStar::search_with(problem, expander, AStar::HIGHER_G, 0, counters, observer);
+}
+} // unnamed namespace
+
+/** Busca a solução do problema. Se o problema for um EncodedProblem, os nós
+ * armazenam apenas o identificador da ação (CompactHeuristicNode). Se não
+ * houver StateHash definido para o estado, a busca é o A* sequencial.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ * @param num_workers número de <i>threads</i> (> 0).
+ * @param counters [out] se fornecido, armazena os contadores da busca
+ * (somados entre as <i>threads</i>).
+ *
+ * @throws std::invalid_argument se num_workers for 0.
+ *
+ * @return IIA::Search::Result o resultado da busca.
+ *
+ * Exemplo de uso:
+ * @code
+ * using namespace IIA::Search;
+ *
+ * NPuzzleProblem problem(initial, goal);
+ * ManhattanDistance h_calc(&(problem.goal_states));
+ * Result<NPuzzleState> result = Informed::HDAStar::search(problem, h_calc, 8);
+ * @endcode */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem,
+					   const HeuristicCalc<state_t> &h_calc,
+					   unsigned int num_workers = Utils::ThreadPool::hardware_workers(),
+					   AStar::Counters *counters = nullptr) {
+	if(num_workers == 0)
+		throw std::invalid_argument("HDA* must have at least one worker.");
+
+	std::integral_constant<bool, StateHash<state_t>::enabled> hashed;
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return search_with(problem, EncodedExpander<state_t, CompactHeuristicNode<state_t> >(*encoded_problem, &h_calc),
+						   num_workers, counters, hashed);
+	return search_with(problem, ActionExpander<state_t, HeuristicNode<state_t> >(problem, &h_calc),
+					   num_workers, counters, hashed);
+}
+} // namespace HDAStar
+} // namespace Informed
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_INFORMED_HDA_STAR_H
@@ -28,6 +28,17 @@ public:
 	/** Calcula a estimativa do custo do estado dado até o(s) objetivo(s). */
 	virtual double eval(const state_t &state) const { return 0; }
 
+	/** Calcula a estimativa do custo do sucessor dado, gerado a partir de
+	 * parent (cuja estimativa, calculada por esta instância, é parent_h),
+	 * permitindo que a heurística seja atualizada incrementalmente. Por
+	 * padrão, equivale a eval(successor).
+	 *
+	 * Buscas que alteram a estimativa dos nós (e.g. BestFirst::RBFS) devem
+	 * usar eval. */
+	virtual double eval_successor(const state_t &successor, const state_t &parent, double parent_h) const {
+		return eval(successor);
+	}
+
 protected:
 	// Attributes
 	/** Indica quais são os objetivos. */
@@ -113,6 +124,28 @@ static HeuristicNode<state_t> *child_node(HeuristicNode<state_t> *parent, Action
 	return node;
 }
 
+/** Retorna a referência para um novo nó, criado na arena dada, como filho da
+ * instância, resultante da execução da ação dada como argumento.
+ *
+ * @param parent o nó pai da nova instância.
+ * @param action ação que origina o novo nó.
+ * @param h_calc a função que calcula a heurística.
+ * @param arena a arena onde o nó é criado (e que é dona do nó). */
+template <class state_t>
+static HeuristicNode<state_t> *child_node(HeuristicNode<state_t> *parent, Action<state_t> *action,
+		const HeuristicCalc<state_t> &h_calc, NodeArena<HeuristicNode<state_t> > &arena) {
+	if(!parent)
+		throw std::invalid_argument("Child node must have a parent.");
+	if(!action)
+		throw std::invalid_argument("Child node must result from an action.");
+
+	HeuristicNode<state_t> *node = arena.create(parent->state, parent, action, parent->path_cost + action->cost);
+	action->execute(node->state);
+	node->h_cost = h_calc.eval(node->state);
+
+	return node;
+}
+
 /** Retorna os nós resultantes da execução das ações fornecidas no estado do nó
  * dado.
  *
@@ -0,0 +1,287 @@
+/** @file IDAStarSearch.h
+ *
+ * Definição do algoritmo de busca com informação IDA*.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_INFORMED_IDA_STAR_H
+#define IIA_SEARCH_INFORMED_IDA_STAR_H
+
+#include <algorithm>
+#include <cstddef> // std::size_t
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "CompactSearchNode.hpp"
+#include "NodeExpander.hpp"
+#include "Problem.hpp"
+#include "SearchResult.hpp"
+#include "Informed/HeuristicSearchNode.hpp"
+
+namespace IIA {
+namespace Search {
+namespace Informed {
+/** Implementação da busca A* com aprofundamento iterativo (<a href="http://en.wikipedia.org/wiki/IDA*">IDA*</a>).
+ * Executa buscas em profundidade limitadas pelo custo estimado
+ * f(n) = g(n) + h(n), e a cada iteração o limite passa a ser o menor f(n) que
+ * excedeu o limite anterior.
+ *
+ * Ao contrário de Uninformed::IterativeDeepening, não são criados nós: o
+ * caminho atual é mantido em uma pilha (reaproveitada entre as iterações) em
+ * que cada nível guarda uma cópia do seu estado e as ações ainda não
+ * exploradas. Cada sucessor é gerado a partir de uma cópia do estado do
+ * nível, de modo que nada precisa ser desfeito ao retirá-lo da pilha. Se o
+ * problema for um EncodedProblem, os sucessores são gerados por
+ * EncodedProblem::for_each_successor e cada nível é um CompactHeuristicNode
+ * na pilha de chamadas, sem alocação de ações. O consumo de memória é linear
+ * na profundidade da solução, acrescido de uma tabela de transposição
+ * opcional, de tamanho fixo. */
+namespace IDAStar {
+/** Tabela de transposição de tamanho fixo, indexada pelo StateHash do estado.
+ * Armazena, para cada estado visitado, o menor custo g(n) com que foi alcançado
+ * na iteração atual, permitindo podar caminhos mais caros até o mesmo estado.
+ * Colisões substituem a entrada anterior (a poda é apenas menos eficiente); a
+ * igualdade de estados é inferida pela igualdade dos valores de espalhamento. */
+template <class state_t>
+class TranspositionTable {
+public:
+	/** Construtor.
+	 *
+	 * @param num_entries número de entradas da tabela. */
+	TranspositionTable(std::size_t num_entries) : table(num_entries) {
+		if(num_entries == 0)
+			throw std::invalid_argument("Transposition table must have at least one entry.");
+	}
+
+	/** Indica se o estado dado já foi alcançado, na iteração dada, com custo
+	 * menor ou igual a g. Caso contrário, registra o estado com custo g. */
+	bool prune(const state_t &state, double g, unsigned int iteration) {
+		std::size_t key = hash(state);
+		Entry &entry = table[key % table.size()];
+		if(entry.iteration == iteration && entry.key == key && entry.g <= g)
+			return true;
+		entry.key = key, entry.g = g, entry.iteration = iteration;
+		return false;
+	}
+
+private:
+	struct Entry {
+		Entry() : key(0), g(0), iteration(0) {}
+		std::size_t key;
+		double g;
+		unsigned int iteration;
+	};
+
+	// Attributes
+	StateHash<state_t> hash;
+	std::vector<Entry> table;
+};
+
+namespace { // unnamed
+// Substitui a tabela de transposição quando esta não é utilizada.
+template <class state_t>
+struct NoTranspositionTable {
+	bool prune(const state_t &state, double g, unsigned int iteration) { return false; }
+};
+
+// Um nível do caminho atual: o estado, seu custo, sua estimativa e as ações
+// ainda não exploradas (a ação em actions[next - 1] leva ao nível seguinte).
+template <class state_t>
+struct Frame {
+	Frame(const state_t &s, double cost, double estimate) : state(s), g(cost), h(estimate), next(0) {}
+	state_t state;
+	double g, h;
+	std::deque<Action<state_t> *> actions;
+	std::size_t next;
+};
+
+// Indica se o estado dado está no caminho atual.
+template <class state_t>
+bool in_path(const std::vector<Frame<state_t> > &path, const state_t &state) {
+	for(const Frame<state_t> &frame : path) if(frame.state == state) return true;
+	return false;
+}
+
+template <class state_t, class table_t>
+Result<state_t> search(const Problem<state_t> &problem, const HeuristicCalc<state_t> &h_calc, table_t &table) {
+	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
+	if(problem.is_goal(problem.initial_state)) {
+		result.status = Result<state_t>::SUCCESS;
+		return result;
+	}
+
+	std::vector<Frame<state_t> > path;
+	double h0 = h_calc.eval(problem.initial_state), threshold = h0;
+	for(unsigned int iteration = 1; ; ++iteration) {
+		double next_threshold = std::numeric_limits<double>::infinity();
+
+		path.push_back(Frame<state_t>(problem.initial_state, 0, h0));
+		path.back().actions = problem.actions(problem.initial_state);
+		while(!path.empty()) {
+			Frame<state_t> &top = path.back();
+			if(top.next == top.actions.size()) {
+				Utils::empty(top.actions);
+				path.pop_back();
+				continue;
+			}
+
+			Action<state_t> *action = top.actions[top.next++];
+			state_t child = top.state;
+			action->execute(child);
+			++result.expanded_nodes;
+
+			double g = top.g + action->cost;
+			if(in_path(path, child) || table.prune(child, g, iteration))
+				continue;
+
+			double h = h_calc.eval_successor(child, top.state, top.h), f = g + h;
+			if(f > threshold) {
+				next_threshold = std::min(next_threshold, f);
+				continue;
+			}
+
+			if(problem.is_goal(child)) {
+				result.status = Result<state_t>::SUCCESS;
+				for(Frame<state_t> &frame : path) {
+					result.actions.push_back(frame.actions[frame.next - 1]->clone());
+					Utils::empty(frame.actions);
+				}
+				return result;
+			}
+
+			path.push_back(Frame<state_t>(child, g, h));
+			path.back().actions = problem.actions(child);
+		}
+
+		if(next_threshold == std::numeric_limits<double>::infinity())
+			return result;
+		threshold = next_threshold;
+	}
+}
+
+// Dados compartilhados pelos níveis da busca em um EncodedProblem.
+template <class state_t, class table_t>
+struct Context {
+	const EncodedProblem<state_t> &problem;
+	const HeuristicCalc<state_t> &h_calc;
+	table_t &table;
+	Result<state_t> &result;
+	unsigned int iteration;
+	double threshold, next_threshold;
+};
+
+// Um nível da busca em um EncodedProblem: recebe os sucessores do nó e se
+// aprofunda em cada um que não exceda o limite.
+template <class state_t, class table_t>
+class Probe : public SuccessorSink<state_t> {
+public:
+	Probe(Context<state_t, table_t> &c, CompactHeuristicNode<state_t> *n) : context(c), node(n) {}
+
+	bool operator()(const state_t &successor, ActionId id, double cost) {
+		++context.result.expanded_nodes;
+
+		double g = node->path_cost + cost;
+		if(in_parent_node(node, successor) || context.table.prune(successor, g, context.iteration))
+			return true;
+
+		double h = context.h_calc.eval_successor(successor, node->state, node->h_cost), f = g + h;
+		if(f > context.threshold) {
+			context.next_threshold = std::min(context.next_threshold, f);
+			return true;
+		}
+
+		CompactHeuristicNode<state_t> child(successor, node, id, g, h);
+		if(context.problem.is_goal(successor)) {
+			context.result = Result<state_t>(Result<state_t>::SUCCESS, &child, context.problem,
+											 context.result.expanded_nodes);
+			return false;
+		}
+
+		Probe deeper(context, &child);
+		context.problem.for_each_successor(child.state, deeper);
+		return (context.result.status != Result<state_t>::SUCCESS);
+	}
+
+private:
+	Context<state_t, table_t> &context;
+	CompactHeuristicNode<state_t> *node;
+};
+
+template <class state_t, class table_t>
+Result<state_t> encoded_search(const EncodedProblem<state_t> &problem, const HeuristicCalc<state_t> &h_calc, table_t &table) {
+	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
+	if(problem.is_goal(problem.initial_state)) {
+		result.status = Result<state_t>::SUCCESS;
+		return result;
+	}
+
+	CompactHeuristicNode<state_t> root(problem.initial_state, nullptr, 0, 0, h_calc.eval(problem.initial_state));
+	Context<state_t, table_t> context = {problem, h_calc, table, result, 0, root.h_cost, 0};
+	for(context.iteration = 1; ; ++context.iteration) {
+		context.next_threshold = std::numeric_limits<double>::infinity();
+
+		Probe<state_t, table_t> probe(context, &root);
+		problem.for_each_successor(root.state, probe);
+
+		if(result.status == Result<state_t>::SUCCESS ||
+		   context.next_threshold == std::numeric_limits<double>::infinity())
+			return result;
+		context.threshold = context.next_threshold;
+	}
+}
+
+// Seleciona a implementação conforme o problema seja ou não codificado.
+template <class state_t, class table_t>
+Result<state_t> search_with(const Problem<state_t> &problem, const HeuristicCalc<state_t> &h_calc, table_t &table) {
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return encoded_search(*encoded_problem, h_calc, table);
+	return search(problem, h_calc, table);
+}
+} // unnamed namespace
+
+/** Busca a solução do problema, utilizando uma tabela de transposição para
+ * podar estados repetidos. Exige StateHash definido para o estado.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ * @param table_entries o número de entradas da tabela de transposição.
+ *
+ * @return IIA::Search::Result o resultado da busca. */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem,
+					   const HeuristicCalc<state_t> &h_calc,
+					   std::size_t table_entries) {
+	static_assert(StateHash<state_t>::enabled, "IDA* transposition table requires StateHash.");
+	TranspositionTable<state_t> table(table_entries);
+	return search_with(problem, h_calc, table);
+}
+
+/** Busca a solução do problema, sem tabela de transposição.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param h_calc a heurística a ser utilizada.
+ *
+ * @return IIA::Search::Result o resultado da busca.
+ *
+ * Exemplo de uso:
+ * @code
+ * using namespace IIA::Search;
+ *
+ * ZeroToFour problem;
+ * Informed::HeuristicCalc<Integer> h_calc(&problem.goal_states);
+ * Result<Integer> result = Informed::IDAStar::search(problem, h_calc);
+ * @endcode */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem, const HeuristicCalc<state_t> &h_calc) {
+	NoTranspositionTable<state_t> table;
+	return search_with(problem, h_calc, table);
+}
+} // namespace IDAStar
+} // namespace Informed
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_INFORMED_IDA_STAR_H
@@ -5,5 +5,8 @@
  * @author Guilherme N. Ramos (gnramos@unb.br)
  * @date 10/2011 */
 
+#include "Informed/AStarSearch.h"
 #include "Informed/BestFirstSearch.h"
+#include "Informed/HDAStarSearch.h"
 #include "Informed/HeuristicSearchNode.hpp"
+#include "Informed/IDAStarSearch.h"
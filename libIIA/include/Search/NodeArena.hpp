@@ -0,0 +1,104 @@
+/** @file NodeArena.hpp
+ *
+ * Definição de um alocador de nós para buscas.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_NODE_ARENA_HPP
+#define IIA_SEARCH_NODE_ARENA_HPP
+
+#include <cstddef> // std::size_t
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace IIA {
+namespace Search {
+/** Alocador de nós para uma busca (@em arena). Os nós são criados
+ * sequencialmente em blocos contíguos (alocação por incremento de ponteiro) e
+ * destruídos todos de uma vez ao final da busca, evitando uma chamada a
+ * new/delete por nó.
+ *
+ * Apenas o último nó criado pode ser efetivamente descartado antes do fim da
+ * busca (caso típico de um filho recém-gerado que é rejeitado por ser
+ * repetido); os demais nós liberados permanecem até clear(). A arena é dona
+ * dos nós: eles não devem ser liberados com delete.
+ *
+ * Exemplo de uso:
+ * @code
+ * NodeArena<Node<Integer> > arena;
+ * Node<Integer> *root = arena.create(problem.initial_state);
+ * Node<Integer> *child = child_node(root, action, arena);
+ * ...
+ * arena.clear(); // destrói todos os nós
+ * @endcode */
+template <class node_t>
+class NodeArena {
+public:
+	/** Construtor.
+	 *
+	 * @param nodes_per_chunk número de nós alocados em cada bloco. */
+	NodeArena(std::size_t nodes_per_chunk = 4096) : chunk_size(nodes_per_chunk), current(0), used(0), count(0) {
+		if(nodes_per_chunk == 0)
+			throw std::invalid_argument("Arena chunks must hold at least one node.");
+	}
+
+	/** Destrutor. Destrói os nós e libera a memória. */
+	~NodeArena() {
+		clear();
+		for(slot_t *chunk : chunks) delete [] chunk;
+	}
+
+	/** Cria um novo nó na arena, repassando os argumentos ao seu construtor. */
+	template <class... args_t>
+	node_t *create(args_t &&... args) {
+		if(chunks.empty())
+			chunks.push_back(new slot_t[chunk_size]);
+		else if(used == chunk_size) {
+			if(++current == chunks.size()) chunks.push_back(new slot_t[chunk_size]);
+			used = 0;
+		}
+		node_t *node = new(&chunks[current][used]) node_t(std::forward<args_t>(args)...);
+		++used, ++count;
+		return node;
+	}
+
+	/** Descarta o nó dado. Se for o último criado, ele é destruído e sua
+	 * memória reaproveitada; caso contrário, permanece até clear(). */
+	void release(node_t *node) {
+		if(used && node == reinterpret_cast<node_t *>(&chunks[current][used - 1])) {
+			node->~node_t();
+			--used, --count;
+		}
+	}
+
+	/** Destrói todos os nós, mantendo os blocos alocados para reuso. */
+	void clear() {
+		for(std::size_t c = 0; c < chunks.size() && c <= current; ++c) {
+			std::size_t n = (c == current ? used : chunk_size);
+			for(std::size_t i = 0; i < n; ++i)
+				reinterpret_cast<node_t *>(&chunks[c][i])->~node_t();
+		}
+		current = 0, used = 0, count = 0;
+	}
+
+	/** Retorna o número de nós existentes na arena. */
+	std::size_t size() const { return count; }
+
+private:
+	typedef typename std::aligned_storage<sizeof(node_t), std::alignment_of<node_t>::value>::type slot_t;
+
+	NodeArena(const NodeArena &);
+	NodeArena &operator= (const NodeArena &);
+
+	// Attributes
+	std::size_t chunk_size, current, used, count;
+	std::vector<slot_t *> chunks;
+};
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_NODE_ARENA_HPP
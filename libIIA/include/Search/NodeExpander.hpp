@@ -0,0 +1,166 @@
+/** @file NodeExpander.hpp
+ *
+ * Definição de geradores de nós filhos para as buscas.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_NODE_EXPANDER_HPP
+#define IIA_SEARCH_NODE_EXPANDER_HPP
+
+#include <deque>
+
+#include "EncodedProblem.hpp"
+#include "NodeArena.hpp"
+#include "SearchResult.hpp"
+
+namespace IIA {
+namespace Search {
+namespace { // unnamed
+// Calcula a heurística do nó, se este a armazenar.
+template <class state_t>
+void evaluate(Uninformed::Node<state_t> *node, const Informed::HeuristicCalc<state_t> *h_calc) {}
+
+template <class state_t>
+void evaluate(Informed::HeuristicNode<state_t> *node, const Informed::HeuristicCalc<state_t> *h_calc) {
+	const Informed::HeuristicNode<state_t> *parent = static_cast<const Informed::HeuristicNode<state_t> *>(node->parent);
+	node->h_cost = (parent ? h_calc->eval_successor(node->state, parent->state, parent->h_cost)
+						   : h_calc->eval(node->state));
+}
+
+template <class state_t>
+void evaluate(CompactNode<state_t> *node, const Informed::HeuristicCalc<state_t> *h_calc) {}
+
+template <class state_t>
+void evaluate(CompactHeuristicNode<state_t> *node, const Informed::HeuristicCalc<state_t> *h_calc) {
+	const CompactHeuristicNode<state_t> *parent = static_cast<const CompactHeuristicNode<state_t> *>(node->parent);
+	node->h_cost = (parent ? h_calc->eval_successor(node->state, parent->state, parent->h_cost)
+						   : h_calc->eval(node->state));
+}
+
+// Cria, na arena, um nó para cada sucessor recebido e o repassa ao visitante.
+template <class state_t, class node_t, class visitor_t>
+class ChildSink : public SuccessorSink<state_t> {
+public:
+	ChildSink(node_t *p, NodeArena<node_t> &a, const Informed::HeuristicCalc<state_t> *h, visitor_t &v) :
+		parent(p), arena(a), h_calc(h), visit(v) {}
+
+	bool operator()(const state_t &successor, ActionId id, double cost) {
+		node_t *child = arena.create(successor, parent, id, parent->path_cost + cost);
+		evaluate(child, h_calc);
+		return visit(child);
+	}
+
+private:
+	node_t *parent;
+	NodeArena<node_t> &arena;
+	const Informed::HeuristicCalc<state_t> *h_calc;
+	visitor_t &visit;
+};
+} // unnamed namespace
+
+/** Gera os filhos de um nó a partir de Problem::actions, com nós
+ * Uninformed::Node ou Informed::HeuristicNode (que clonam a ação).
+ *
+ * As buscas são escritas em função de um gerador (ActionExpander ou
+ * EncodedExpander), de modo que o mesmo algoritmo atende a ambas as
+ * formulações de problema. */
+template <class state_t, class node_t>
+class ActionExpander {
+public:
+	/** O tipo de nó gerado. */
+	typedef node_t node_type;
+
+	/** Construtor.
+	 *
+	 * @param p o problema.
+	 * @param h a heurística, obrigatória se o nó a armazenar. */
+	ActionExpander(const Problem<state_t> &p, const Informed::HeuristicCalc<state_t> *h = nullptr) :
+		problem(p), h_calc(h) {}
+
+	/** Cria, na arena dada, o nó do estado inicial do problema. */
+	node_t *root(NodeArena<node_t> &arena) const {
+		node_t *node = arena.create(problem.initial_state);
+		evaluate(node, h_calc);
+		return node;
+	}
+
+	/** Cria, na arena dada, cada filho do nó e o repassa a visit, até que
+	 * este retorne false. */
+	template <class visitor_t>
+	void expand(node_t *node, NodeArena<node_t> &arena, visitor_t visit) const {
+		std::deque<Action<state_t> *> actions = problem.actions(node->state);
+		for(Action<state_t> *action : actions) {
+			node_t *child = arena.create(node->state, node, action, node->path_cost + action->cost);
+			action->execute(child->state);
+			evaluate(child, h_calc);
+			if(!visit(child)) break;
+		}
+		Utils::empty(actions);
+	}
+
+	/** Cria o resultado da busca a partir do último nó do caminho. */
+	Result<state_t> result(typename Result<state_t>::Status status, const node_t *node,
+						   long unsigned int nodes) const {
+		return Result<state_t>(status, node, nodes);
+	}
+
+private:
+	// Attributes
+	const Problem<state_t> &problem;
+	const Informed::HeuristicCalc<state_t> *h_calc;
+};
+
+/** Gera os filhos de um nó a partir de EncodedProblem::for_each_successor,
+ * com nós CompactNode ou CompactHeuristicNode. Nenhuma ação é instanciada
+ * durante a busca. */
+template <class state_t, class node_t>
+class EncodedExpander {
+public:
+	/** O tipo de nó gerado. */
+	typedef node_t node_type;
+
+	/** Construtor.
+	 *
+	 * @param p o problema.
+	 * @param h a heurística, obrigatória se o nó a armazenar. */
+	EncodedExpander(const EncodedProblem<state_t> &p, const Informed::HeuristicCalc<state_t> *h = nullptr) :
+		problem(p), h_calc(h) {}
+
+	/** Cria, na arena dada, o nó do estado inicial do problema. */
+	node_t *root(NodeArena<node_t> &arena) const {
+		node_t *node = arena.create(problem.initial_state);
+		evaluate(node, h_calc);
+		return node;
+	}
+
+	/** Cria, na arena dada, cada filho do nó e o repassa a visit, até que
+	 * este retorne false. */
+	template <class visitor_t>
+	void expand(node_t *node, NodeArena<node_t> &arena, visitor_t visit) const {
+		ChildSink<state_t, node_t, visitor_t> sink(node, arena, h_calc, visit);
+		problem.for_each_successor(node->state, sink);
+	}
+
+	/** Cria o resultado da busca a partir do último nó do caminho. */
+	Result<state_t> result(typename Result<state_t>::Status status, const node_t *node,
+						   long unsigned int nodes) const {
+		return Result<state_t>(status, node, problem, nodes);
+	}
+
+private:
+	// Attributes
+	const EncodedProblem<state_t> &problem;
+	const Informed::HeuristicCalc<state_t> *h_calc;
+};
+
+/** Retorna o problema como EncodedProblem, ou nulo se ele não implementar a
+ * interface codificada. */
+template <class state_t>
+const EncodedProblem<state_t> *encoded(const Problem<state_t> &problem) {
+	return dynamic_cast<const EncodedProblem<state_t> *>(&problem);
+}
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_NODE_EXPANDER_HPP
@@ -0,0 +1,168 @@
+/** @file PriorityFrontier.hpp
+ *
+ * Definição de uma fronteira de busca ordenada por prioridade.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_PRIORITY_FRONTIER_HPP
+#define IIA_SEARCH_PRIORITY_FRONTIER_HPP
+
+#include <cstddef> // std::size_t
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "State.hpp"
+
+namespace IIA {
+namespace Search {
+/** Define uma fronteira de busca como um <i>heap</i> binário de ponteiros para
+ * nós, indexado pelo estado de cada nó. Inserção e remoção do nó prioritário
+ * custam O(log n); a busca por um estado custa O(1) (em média) se houver
+ * StateHash para o estado, O(log n) caso contrário. A fronteira contém no
+ * máximo um nó por estado e <b>não</b> gerencia a memória dos nós.
+ *
+ * O comparador deve indicar se o primeiro nó tem <b>menor</b> prioridade que o
+ * segundo, ou seja, compare(lhs, rhs) verdadeiro faz rhs ser removido antes
+ * (como em std::priority_queue).
+ *
+ * Exemplo de uso:
+ * @code
+ * struct HigherPathCost {
+ * 	bool operator()(const Node<Integer> *lhs, const Node<Integer> *rhs) const {
+ * 		return lhs->path_cost > rhs->path_cost;
+ * 	}
+ * };
+ *
+ * PriorityFrontier<Integer, Node<Integer>, HigherPathCost> frontier;
+ * frontier.push(new Node<Integer>(Integer(0)));
+ * Node<Integer> *node = frontier.pop(); // nó de menor custo
+ * @endcode */
+template <class state_t, class node_t, class compare_t>
+class PriorityFrontier {
+public:
+	/** Construtor.
+	 *
+	 * @param cmp o comparador de prioridade dos nós. */
+	PriorityFrontier(const compare_t &cmp = compare_t()) : compare(cmp) {}
+
+	/** Indica se a fronteira está vazia. */
+	bool empty() const { return heap.empty(); }
+
+	/** Retorna o número de nós na fronteira. */
+	std::size_t size() const { return heap.size(); }
+
+	/** Retorna o nó prioritário, sem removê-lo da fronteira. */
+	node_t *top() const {
+		if(heap.empty())
+			throw std::out_of_range("Cannot get top of empty frontier.");
+		return heap.front();
+	}
+
+	/** Insere o nó dado na fronteira. Não pode haver outro nó com o mesmo
+	 * estado na fronteira. */
+	void push(node_t *node) {
+		if(!index.insert(typename StateMap<state_t, node_t *>::type::value_type(node->state, node)).second)
+			throw std::invalid_argument("Frontier already contains a node with this state.");
+		heap.push_back(node);
+		position[node] = heap.size() - 1;
+		sift_up(heap.size() - 1);
+	}
+
+	/** Remove e retorna o nó prioritário. */
+	node_t *pop() {
+		node_t *node = top();
+		remove_at(0);
+		return node;
+	}
+
+	/** Retorna o nó da fronteira com o estado dado, se houver (nullptr caso
+	 * contrário). */
+	node_t *find(const state_t &state) const {
+		typename StateMap<state_t, node_t *>::type::const_iterator it = index.find(state);
+		return (it == index.end() ? nullptr : it->second);
+	}
+
+	/** Substitui, na fronteira, o nó com o mesmo estado do nó dado por este
+	 * (ex: quando se encontra um caminho de menor custo até o estado), e
+	 * retorna o nó substituído. */
+	node_t *replace(node_t *node) {
+		node_t *old = find(node->state);
+		if(!old)
+			throw std::invalid_argument("Frontier does not contain a node with this state.");
+
+		std::size_t i = position[old];
+		position.erase(old);
+		index[node->state] = node;
+		heap[i] = node, position[node] = i;
+		sift_up(i), sift_down(position[node]);
+
+		return old;
+	}
+
+	/** Reposiciona o nó dado, que já está na fronteira, após a alteração de sua
+	 * prioridade. */
+	void update(node_t *node) {
+		typename std::unordered_map<const node_t *, std::size_t>::iterator it = position.find(node);
+		if(it == position.end())
+			throw std::invalid_argument("Frontier does not contain this node.");
+		std::size_t i = it->second;
+		sift_up(i), sift_down(position[node]);
+	}
+
+	/** Retorna os nós da fronteira (em ordem arbitrária). */
+	const std::vector<node_t *> &nodes() const { return heap; }
+
+	/** Remove todos os nós da fronteira, sem liberar sua memória. */
+	void clear() { heap.clear(), index.clear(), position.clear(); }
+
+private:
+	void remove_at(std::size_t i) {
+		node_t *node = heap[i];
+		index.erase(node->state), position.erase(node);
+
+		if(i != heap.size() - 1) {
+			heap[i] = heap.back(), position[heap[i]] = i;
+			heap.pop_back();
+			sift_up(i), sift_down(position[heap[i]]);
+		} else heap.pop_back();
+	}
+
+	void swap(std::size_t i, std::size_t j) {
+		std::swap(heap[i], heap[j]);
+		position[heap[i]] = i, position[heap[j]] = j;
+	}
+
+	void sift_up(std::size_t i) {
+		while(i > 0) {
+			std::size_t parent = (i - 1) / 2;
+			if(!compare(heap[parent], heap[i])) break;
+			swap(i, parent), i = parent;
+		}
+	}
+
+	void sift_down(std::size_t i) {
+		while(true) {
+			std::size_t best = i, left = 2 * i + 1, right = left + 1;
+			if(left < heap.size() && compare(heap[best], heap[left])) best = left;
+			if(right < heap.size() && compare(heap[best], heap[right])) best = right;
+			if(best == i) break;
+			swap(i, best), i = best;
+		}
+	}
+
+	// Attributes
+	/** Comparador de prioridade. */
+	compare_t compare;
+	/** O heap binário. */
+	std::vector<node_t *> heap;
+	/** Mapeia cada estado no nó da fronteira que o contém. */
+	typename StateMap<state_t, node_t *>::type index;
+	/** Mapeia cada nó em sua posição no heap. */
+	std::unordered_map<const node_t *, std::size_t> position;
+};
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_PRIORITY_FRONTIER_HPP
@@ -0,0 +1,240 @@
+/** @file SearchObserver.hpp
+ *
+ * Definição de observadores de buscas, para instrumentação e rastreamento.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_SEARCH_OBSERVER_HPP
+#define IIA_SEARCH_OBSERVER_HPP
+
+#include <cstddef> // std::size_t
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SearchResult.hpp"
+#include "TimeUtils.h"
+
+namespace IIA {
+namespace Search {
+/** Fases de uma busca cronometradas pelos observadores. */
+enum SearchPhase {
+	SELECTION,	/**< Retirada do próximo nó da fronteira. */
+	GOAL_TEST,	/**< Teste de objetivo. */
+	EXPANSION,	/**< Geração dos filhos e sua inserção (ou descarte). */
+	NUM_PHASES	/**< Número de fases. */
+};
+
+/** Observador que ignora os eventos da busca. É o observador padrão das buscas
+ * instrumentadas: como todos os métodos são vazios e <i>inline</i>, o
+ * compilador os elimina, e a busca não tem custo adicional.
+ *
+ * Um observador é qualquer classe com os mesmos métodos; a busca os chama
+ * conforme os eventos ocorrem.
+ *
+ * Apenas estas buscas aceitam observadores:
+ * Uninformed::BreadthFirst::search_tree e search_graph,
+ * Uninformed::UniformCost::search e Informed::AStar::search. As demais
+ * (BreadthFirst::parallel_search_graph, DepthLimited, IterativeDeepening,
+ * Bidirectional, BestFirst, IDAStar e HDAStar) não são instrumentadas, e
+ * informam apenas os contadores de seu Result. */
+struct NullObserver {
+	/** Um filho foi gerado. */
+	void generated() {}
+	/** Um nó foi expandido (seus filhos foram gerados). */
+	void expanded() {}
+	/** Um filho foi descartado por ter estado repetido. */
+	void pruned() {}
+	/** Um estado já explorado foi reaberto (caminho de menor custo). */
+	void reopened() {}
+	/** A fronteira tem o número de nós dado (após uma expansão). */
+	void frontier(std::size_t nodes) {}
+	/** Os nós da busca ocupam o número de bytes dado (após uma expansão). */
+	void memory(std::size_t bytes) {}
+	/** Início da fase dada. */
+	void begin(SearchPhase phase) {}
+	/** Fim da fase dada. */
+	void end(SearchPhase phase) {}
+};
+
+/** Observador que acumula contadores dos eventos da busca, os picos da
+ * fronteira e da memória dos nós, e o tempo de CPU (da <i>thread</i>, via
+ * IIA::Utils::Time) de cada fase.
+ *
+ * A memória considerada é a dos nós na arena da busca (NodeArena), sem os
+ * dados que os estados eventualmente aloquem.
+ *
+ * Exemplo de uso:
+ * @code
+ * using namespace IIA::Search;
+ *
+ * SearchStats stats;
+ * Result<Integer> result = Uninformed::UniformCost::search(problem, stats);
+ * std::cout << stats.expanded_nodes << " expandidos\n";
+ * @endcode */
+class SearchStats {
+public:
+	/** Construtor. */
+	SearchStats() : generated_nodes(0), expanded_nodes(0), pruned_nodes(0), reopened_nodes(0),
+					peak_frontier(0), peak_memory(0) {
+		for(int p = 0; p < NUM_PHASES; ++p) phase_ns[p] = 0;
+	}
+
+	/** Retorna o nome da fase dada. */
+	static const char *phase_name(SearchPhase phase) {
+		switch(phase) {
+		case SELECTION: return "selection";
+		case GOAL_TEST: return "goal_test";
+		case EXPANSION: return "expansion";
+		default: return "unknown";
+		}
+	}
+
+	/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+	void generated() { ++generated_nodes; }
+	void expanded() { ++expanded_nodes; }
+	void pruned() { ++pruned_nodes; }
+	void reopened() { ++reopened_nodes; }
+	void frontier(std::size_t nodes) { if(nodes > peak_frontier) peak_frontier = nodes; }
+	void memory(std::size_t bytes) { if(bytes > peak_memory) peak_memory = bytes; }
+	void begin(SearchPhase phase) { Utils::Time::get_thread_cpu_time(start[phase]); }
+	void end(SearchPhase phase) {
+		timespec now;
+		Utils::Time::get_thread_cpu_time(now);
+		phase_ns[phase] += Utils::Time::to_nano(Utils::Time::time_diff(start[phase], now));
+	}
+	/** @endcond DOXYGEN_SHOULD_SKIP_THIS */
+
+	// Attributes
+	/** Número de filhos gerados. */
+	long unsigned int generated_nodes;
+	/** Número de nós expandidos. */
+	long unsigned int expanded_nodes;
+	/** Número de filhos descartados por terem estado repetido. */
+	long unsigned int pruned_nodes;
+	/** Número de estados explorados que foram reabertos. */
+	long unsigned int reopened_nodes;
+	/** Maior número de nós na fronteira. */
+	std::size_t peak_frontier;
+	/** Maior número de bytes ocupados pelos nós. */
+	std::size_t peak_memory;
+	/** Tempo de CPU (em nanossegundos) de cada fase. */
+	double phase_ns[NUM_PHASES];
+
+private:
+	timespec start[NUM_PHASES];
+};
+
+/** Escreve os contadores de buscas (SearchStats) como <i>JSON lines</i>: um
+ * objeto JSON por linha, por busca, o que permite comparar execuções com
+ * ferramentas comuns (jq, pandas...).
+ *
+ * Exemplo de uso:
+ * @code
+ * std::ofstream file("trace.jsonl");
+ * IIA::Search::JsonLinesExporter exporter(file);
+ * exporter.write({{"problem", "NPuzzle"}, {"search", "AStar"}}, stats, result);
+ * @endcode
+ *
+ * Produz:
+ * @code
+ * {"problem":"NPuzzle","search":"AStar","status":"Success","depth":12,"cost":12,"generated":...}
+ * @endcode */
+class JsonLinesExporter {
+public:
+	/** Rótulos que identificam a busca (nome e valor). */
+	typedef std::vector<std::pair<std::string, std::string> > Labels;
+
+	/** Construtor.
+	 *
+	 * @param output a saída em que as linhas são escritas. */
+	explicit JsonLinesExporter(std::ostream &output) : os(output) {}
+
+	/** Escreve uma linha com os rótulos e os contadores dados. */
+	void write(const Labels &labels, const SearchStats &stats) {
+		std::ostringstream line;
+		line << '{';
+		write_labels(line, labels);
+		write_stats(line, stats);
+		line << '}';
+		os << line.str() << std::endl;
+	}
+
+	/** Escreve uma linha com os rótulos, o resultado (situação, número de
+	 * ações e custo da solução) e os contadores dados. */
+	template <class state_t>
+	void write(const Labels &labels, const SearchStats &stats, const Result<state_t> &result) {
+		double cost = 0;
+		for(auto action : result.actions) cost += action->cost;
+
+		std::ostringstream line;
+		line << '{';
+		write_labels(line, labels);
+		line << "\"status\":";
+		write_string(line, Utils::String::to_string(result.status));
+		line << ",\"depth\":" << result.actions.size()
+			 << ",\"cost\":" << cost
+			 << ",\"nodes\":" << result.expanded_nodes << ',';
+		write_stats(line, stats);
+		line << '}';
+		os << line.str() << std::endl;
+	}
+
+private:
+	JsonLinesExporter(const JsonLinesExporter &);
+	JsonLinesExporter &operator=(const JsonLinesExporter &);
+
+	// Escreve a string dada entre aspas, com os caracteres especiais escapados.
+	static void write_string(std::ostream &line, const std::string &text) {
+		line << '"';
+		for(char c : text) {
+			switch(c) {
+			case '"': line << "\\\""; break;
+			case '\\': line << "\\\\"; break;
+			case '\n': line << "\\n"; break;
+			case '\t': line << "\\t"; break;
+			default:
+				if(static_cast<unsigned char>(c) < 0x20)
+					line << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+				else line << c;
+			}
+		}
+		line << '"';
+	}
+
+	static void write_labels(std::ostream &line, const Labels &labels) {
+		for(const std::pair<std::string, std::string> &label : labels) {
+			write_string(line, label.first);
+			line << ':';
+			write_string(line, label.second);
+			line << ',';
+		}
+	}
+
+	static void write_stats(std::ostream &line, const SearchStats &stats) {
+		line << "\"generated\":" << stats.generated_nodes
+			 << ",\"expanded\":" << stats.expanded_nodes
+			 << ",\"pruned\":" << stats.pruned_nodes
+			 << ",\"reopened\":" << stats.reopened_nodes
+			 << ",\"peak_frontier\":" << stats.peak_frontier
+			 << ",\"peak_memory\":" << stats.peak_memory
+			 << ",\"cpu_ns\":{" << std::fixed << std::setprecision(0);
+		for(int p = 0; p < NUM_PHASES; ++p) {
+			if(p) line << ',';
+			write_string(line, SearchStats::phase_name(SearchPhase(p)));
+			line << ':' << stats.phase_ns[p];
+		}
+		line << '}';
+	}
+
+	// Attributes
+	std::ostream &os;
+};
+} // namespace Search
+} // namespace IIA
+
+#endif // IIA_SEARCH_OBSERVER_HPP
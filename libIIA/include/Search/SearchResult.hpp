@@ -8,13 +8,21 @@
 #ifndef IIA_SEARCH_RESULT_HPP
 #define	IIA_SEARCH_RESULT_HPP
 
+#include <utility>
+#include <vector>
+
+#include "CompactSearchNode.hpp"
 #include "Uninformed/UninformedSearchNode.hpp"
 #include "Informed/HeuristicSearchNode.hpp"
 
 namespace IIA {
 namespace Search {
 /** Define o resultado de busca por soluções. Uma solução é uma sequência de
-* ações que leva do estado inicial ao objetivo. */
+* ações que leva do estado inicial ao objetivo.
+*
+* O resultado é dono das ações da solução: copiá-lo clona cada ação, mas
+* movê-lo (ex: ao retornar de uma função ou de uma chamada recursiva) apenas
+* transfere o vetor, sem alocações. */
 template <class state_t>
 class Result {
 public:
@@ -47,15 +55,59 @@ public:
 	    status(stat), 
 	    expanded_nodes(nodes_expanded) {
 		if(last_node) {
-			Uninformed::Node<state_t> *node = const_cast<Uninformed::Node<state_t> *>(last_node);
-			while(node && node->action) {
-				actions.push_front(node->action->clone());
-				node = node->parent;
-			}
+			std::size_t depth = 0;
+			for(const Uninformed::Node<state_t> *node = last_node; node && node->action; node = node->parent)
+				++depth;
+
+			actions.resize(depth);
+			for(const Uninformed::Node<state_t> *node = last_node; depth; node = node->parent)
+				actions[--depth] = node->action->clone();
+		} else if(status == SUCCESS)
+			throw std::invalid_argument("Cannot have successful result without a last_node.");
+	}
+
+	/** Construtor para buscas em problemas codificados. As ações do caminho
+	 * são instanciadas a partir de seus identificadores.
+	 *
+	 * @param stat o status do resultado.
+	 * @param last_node o último nó do caminho.
+	 * @param problem o problema que define as ações.
+	 * @param nodes_expanded número de nós criados durante a busca. */
+	Result(	const Status stat,
+	       	const CompactNode<state_t> *last_node,
+	       	const EncodedProblem<state_t> &problem,
+	       	long unsigned int nodes_expanded) :
+	    status(stat),
+	    expanded_nodes(nodes_expanded) {
+		if(last_node) {
+			std::size_t depth = 0;
+			for(const CompactNode<state_t> *node = last_node; node->parent; node = node->parent)
+				++depth;
+
+			actions.resize(depth);
+			for(const CompactNode<state_t> *node = last_node; depth; node = node->parent)
+				actions[--depth] = problem.decode(node->action);
 		} else if(status == SUCCESS)
 			throw std::invalid_argument("Cannot have successful result without a last_node.");
 	}
 
+	/** Cria uma nova instância como cópia do resultado dado. */
+	Result(const Result &that) :
+		status(that.status),
+		expanded_nodes(that.expanded_nodes) {
+		actions.reserve(that.actions.size());
+		for(auto action : that.actions) actions.push_back(action->clone());
+	}
+
+	/** Cria uma nova instância com a solução do resultado dado, que fica
+	 * vazio. */
+	Result(Result &&that) :
+		status(that.status),
+		actions(std::move(that.actions)),
+		expanded_nodes(that.expanded_nodes) {
+		that.actions.clear();
+	}
+
 	/** Destrutor. Gerencia a memória conforme necessário. */
 	virtual ~Result() { Utils::empty(actions); }
 
@@ -64,12 +116,24 @@ public:
 		if(this != &that) {
 			this->status = that.status;
 			Utils::empty(this->actions);
+			this->actions.reserve(that.actions.size());
 			for(auto action : that.actions) this->actions.push_back(action->clone());
 			this->expanded_nodes = that.expanded_nodes;
 		}
 		return *this;
 	}
 
+	/** Define a instância com a solução do resultado dado, que fica vazio. */
+	Result &operator= (Result &&that) {
+		if(this != &that) {
+			this->status = that.status;
+			Utils::empty(this->actions);
+			this->actions.swap(that.actions);
+			this->expanded_nodes = that.expanded_nodes;
+		}
+		return *this;
+	}
+
 	/** Converte o resultado em string. */
 	friend std::ostream &operator <<(std::ostream &os, const Result &result) {
 		os << result.status
@@ -86,8 +150,8 @@ public:
 	// Attributes
 	/** Indica o status do resultado. */
 	Status status;
-	/** Armazena a solução, se houver. */
-	std::deque<Action<state_t> *> actions;
+	/** Armazena a solução, se houver, em ordem de execução. */
+	std::vector<Action<state_t> *> actions;
 	/** Indica quantos nós foram criados para executar a busca. */
 	long unsigned int expanded_nodes;
 };
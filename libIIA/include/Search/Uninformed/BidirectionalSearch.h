@@ -8,13 +8,23 @@
 #ifndef IIA_SEARCH_UNINFORMED_BIDIRECTIONAL_H
 #define IIA_SEARCH_UNINFORMED_BIDIRECTIONAL_H
 
+#include <limits>
+#include <type_traits>
+
+#include "NodeExpander.hpp"
 #include "Problem.hpp"
+#include "PriorityFrontier.hpp"
 #include "SearchResult.hpp"
+#include "UniformCostSearch.h"
 
 namespace IIA {
 namespace Search {
 namespace Uninformed {
-/** @todo Documentação da busca bidirecional. Teste unitário */
+/** Implementação da busca bidirecional. A
+ * <a href="http://en.wikipedia.org/wiki/Bidirectional_search">busca
+ * bidirecional</a> executa simultaneamente uma busca a partir do estado
+ * inicial (usando Problem::actions) e outra a partir dos objetivos (usando
+ * Problem::predecessors), e termina quando as duas se encontram. */
 namespace Bidirectional {
 
 namespace {
@@ -38,23 +48,11 @@ void empty(std::deque<std::pair<state_t, IIA::Action<state_t> *> > &container) {
 		delete pair.second;
 	container.clear();
 }
-} // unnamed namespace
-
 
-/** Busca a solução do problema usando um grafo (@em não aceita nós com estados
- * já visitados).
- *
- * @param problem o problema a ser solucionado.
- *
- * Exemplo de uso:
- * @code
- * using namespace IIA::Search;
- *
- * ZeroToFour problem;
- * Result<Integer> result = Uninformed::Bidirectional::search(problem);
- * @endcode */
+// Busca em largura nos dois sentidos, verificando estados repetidos e o
+// encontro das buscas por varredura linear (estados sem StateHash).
 template <class state_t>
-Result<state_t> search(const Problem<state_t> &problem) {
+Result<state_t> linear_search(const Problem<state_t> &problem) {
 	if(problem.is_goal(problem.initial_state)) {
 		Node<state_t> node(problem.initial_state);
 		return Result<state_t>(Result<state_t>::SUCCESS, &node, 1);
@@ -136,6 +134,146 @@ Result<state_t> search(const Problem<state_t> &problem) {
 
 	return result;
 }
+
+// Um dos sentidos da busca: fronteira ordenada pelo custo do caminho e
+// estados explorados, ambos indexados por StateHash.
+template <class state_t>
+struct Side {
+	PriorityFrontier<state_t, Node<state_t>, UniformCost::HigherPathCost<Node<state_t> > > frontier;
+	typename StateMap<state_t, Node<state_t> *>::type explored;
+	NodeArena<Node<state_t> > arena;
+
+	// Retorna o nó do estado dado (na fronteira ou explorado), se houver.
+	Node<state_t> *find(const state_t &state) const {
+		typename StateMap<state_t, Node<state_t> *>::type::const_iterator it = explored.find(state);
+		return (it != explored.end() ? it->second : frontier.find(state));
+	}
+
+	// Insere o filho na fronteira (ou nela substitui o nó de mesmo estado, se
+	// o custo for menor), retornando falso se ele for descartado.
+	bool insert(Node<state_t> *child) {
+		if(explored.count(child->state)) {
+			arena.release(child);
+			return false;
+		}
+
+		Node<state_t> *aux_node = frontier.find(child->state);
+		if(!aux_node)
+			frontier.push(child);
+		else if(child->path_cost < aux_node->path_cost)
+			arena.release(frontier.replace(child));
+		else {
+			arena.release(child);
+			return false;
+		}
+		return true;
+	}
+};
+
+// Busca com custo uniforme nos dois sentidos (Dijkstra bidirecional). A cada
+// passo é expandido o sentido com a menor fronteira; cada nó mantido é
+// procurado no outro sentido, e o menor custo de um caminho que passe por um
+// desses encontros é a melhor solução conhecida. A busca termina quando a
+// soma dos menores custos das duas fronteiras atinge esse valor, pois nenhum
+// caminho ainda não encontrado pode ser mais barato.
+template <class state_t>
+Result<state_t> hashed_search(const Problem<state_t> &problem) {
+	Side<state_t> fwd, bwd;
+	fwd.frontier.push(fwd.arena.create(problem.initial_state));
+	for(const state_t &state : problem.goal_states)
+		if(!bwd.frontier.find(state)) bwd.frontier.push(bwd.arena.create(state));
+
+	long unsigned int expanded_nodes = fwd.frontier.size() + bwd.frontier.size();
+	double best_cost = std::numeric_limits<double>::infinity();
+	const Node<state_t> *fwd_meet = nullptr, *bwd_meet = nullptr;
+
+	// Verifica se o nó dado, mantido em um sentido, encontra o outro.
+	auto meet = [&](const Node<state_t> *fwd_node, const Node<state_t> *bwd_node) {
+		if(fwd_node && bwd_node && fwd_node->path_cost + bwd_node->path_cost < best_cost) {
+			best_cost = fwd_node->path_cost + bwd_node->path_cost;
+			fwd_meet = fwd_node, bwd_meet = bwd_node;
+		}
+	};
+	meet(fwd.frontier.top(), bwd.find(problem.initial_state));
+
+	while(!fwd.frontier.empty()) {
+		const double lower_bound = fwd.frontier.top()->path_cost +
+								   (bwd.frontier.empty() ? 0 : bwd.frontier.top()->path_cost);
+		if(lower_bound >= best_cost) break;
+
+		if(bwd.frontier.empty() || fwd.frontier.size() <= bwd.frontier.size()) {
+			Node<state_t> *node = fwd.frontier.pop();
+			fwd.explored[node->state] = node;
+
+			std::deque<Action<state_t> *> actions = problem.actions(node->state);
+			for(Action<state_t> *action : actions) {
+				Node<state_t> *child = fwd.arena.create(node->state, node, action, node->path_cost + action->cost);
+				action->execute(child->state);
+				++expanded_nodes;
+				if(fwd.insert(child)) meet(child, bwd.find(child->state));
+			}
+			Utils::empty(actions);
+		} else {
+			Node<state_t> *node = bwd.frontier.pop();
+			bwd.explored[node->state] = node;
+
+			std::deque<std::pair<state_t, Action<state_t> *> > predecessors = problem.predecessors(node->state);
+			for(std::pair<state_t, Action<state_t> *> &pair : predecessors) {
+				Node<state_t> *child = bwd.arena.create(pair.first, node, pair.second, node->path_cost + pair.second->cost);
+				++expanded_nodes;
+				if(bwd.insert(child)) meet(fwd.find(child->state), child);
+			}
+			empty(predecessors);
+		}
+	}
+
+	if(!fwd_meet) return Result<state_t>(Result<state_t>::FAILURE, nullptr, expanded_nodes);
+
+	// O caminho de volta é percorrido dos pais para os objetivos: a ação de
+	// cada nó leva do seu estado ao estado do pai.
+	Result<state_t> result(Result<state_t>::SUCCESS, fwd_meet, expanded_nodes);
+	for(const Node<state_t> *node = bwd_meet; node->parent; node = node->parent)
+		result.actions.push_back(node->action->clone());
+	return result;
+}
+
+// Seleciona a implementação conforme a existência de StateHash para o estado.
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem, std::false_type) {
+	return linear_search(problem);
+}
+
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem, std::true_type) {
+	return hashed_search(problem);
+}
+} // unnamed namespace
+
+/** Busca a solução do problema usando um grafo (@em não aceita nós com estados
+ * já visitados).
+ *
+ * Se houver StateHash definido para o estado, as fronteiras e os conjuntos
+ * explorados dos dois sentidos são indexados por ele, o sentido com a menor
+ * fronteira é expandido a cada passo, e a busca é de custo uniforme: a
+ * solução encontrada tem o menor custo (como em UniformCost::search). Caso
+ * contrário, os sentidos se alternam em largura e estados repetidos são
+ * verificados por varredura linear.
+ *
+ * O problema deve implementar Problem::predecessors.
+ *
+ * @param problem o problema a ser solucionado.
+ *
+ * Exemplo de uso:
+ * @code
+ * using namespace IIA::Search;
+ *
+ * ZeroToFour problem;
+ * Result<Integer> result = Uninformed::Bidirectional::search(problem);
+ * @endcode */
+template <class state_t>
+Result<state_t> search(const Problem<state_t> &problem) {
+	return search(problem, std::integral_constant<bool, StateHash<state_t>::enabled>());
+}
 } // namespace Bidirectional
 } // namespace Uninformed
 } // namespace Search
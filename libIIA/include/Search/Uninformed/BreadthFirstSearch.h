@@ -8,8 +8,18 @@
 #ifndef IIA_SEARCH_UNINFORMED_BREADTH_FIRST_H
 #define IIA_SEARCH_UNINFORMED_BREADTH_FIRST_H
 
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "ConcurrentStateSet.hpp"
+#include "NodeExpander.hpp"
 #include "Problem.hpp"
+#include "SearchObserver.hpp"
 #include "SearchResult.hpp"
+#include "ThreadPool.h"
 
 namespace IIA {
 namespace Search {
@@ -19,82 +29,302 @@ namespace Uninformed {
  * é um método de busca não-informada que expande e examina sistematicamente
  * todos os nós de cada nível de uma árvore, em busca de uma solução. */
 namespace BreadthFirst {
-/** Busca a solução do problema usando uma árvore (aceita nós com estados já
- * visitados).
- *
- * @param problem o problema a ser solucionado. */
-template <class state_t>
-Result<state_t> search_tree(const Problem<state_t> &problem) {
-	std::deque<Node<state_t> *> frontier(1, new Node<state_t>(problem.initial_state));
+namespace { // unnamed
+// Busca em árvore (aceita nós com estados já visitados).
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> search_tree(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer) {
+	typedef typename expander_t::node_type node_t;
+
+	NodeArena<node_t> arena;
+	std::deque<node_t *> frontier(1, expander.root(arena));
 	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
 
 	while(!frontier.empty()) {
-		Node<state_t> *node = frontier.front();
+		observer.begin(SELECTION);
+		node_t *node = frontier.front();
 		frontier.pop_front(); // FIFO
+		observer.end(SELECTION);
 
-		if(problem.is_goal(node->state)) {
-			result = Result<state_t>(Result<state_t>::SUCCESS, node, result.expanded_nodes);
-			delete node;
+		observer.begin(GOAL_TEST);
+		const bool goal = problem.is_goal(node->state);
+		observer.end(GOAL_TEST);
+		if(goal) {
+			result = expander.result(Result<state_t>::SUCCESS, node, result.expanded_nodes);
 			break;
 		}
 
-		std::deque<Action<state_t> *> actions = problem.actions(node->state);
-		std::deque<Node<state_t> *>  children = children_nodes(node, actions);
-
-		result.expanded_nodes += children.size();
-		Utils::empty(actions);
-
-		frontier.insert(frontier.end(), children.begin(), children.end());
+		observer.begin(EXPANSION), observer.expanded();
+		expander.expand(node, arena, [&](node_t *child) -> bool {
+			++result.expanded_nodes, observer.generated();
+			frontier.push_back(child);
+			return true;
+		});
+		observer.end(EXPANSION);
+		observer.frontier(frontier.size()), observer.memory(arena.size() * sizeof(node_t));
 	}
 
-	Utils::empty(frontier);
-
 	return result;
 }
 
-/** Busca a solução do problema usando um grafo (@em não aceita nós com estados
- * já visitados).
- *
- * @param problem o problema a ser solucionado. */
-template <class state_t>
-Result<state_t> search_graph(const Problem<state_t> &problem) {
-	if(problem.is_goal(problem.initial_state)) {
-		Node<state_t> node(problem.initial_state);
-		return Result<state_t>(Result<state_t>::SUCCESS, &node, 1);
-	}
+// Busca em grafo verificando estados repetidos por varredura linear da
+// fronteira e do conjunto explorado (estados sem StateHash).
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> linear_search_graph(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer) {
+	typedef typename expander_t::node_type node_t;
+
+	NodeArena<node_t> arena;
+	std::deque<node_t *> frontier(1, expander.root(arena));
+	if(problem.is_goal(problem.initial_state))
+		return expander.result(Result<state_t>::SUCCESS, frontier.front(), 1);
 
-	std::deque<Node<state_t> *> frontier(1, new Node<state_t>(problem.initial_state));
-	std::deque<Node<state_t> *> explored;
+	std::deque<node_t *> explored;
 
 	Result<state_t> result(Result<state_t>::FAILURE, nullptr, frontier.size());
 
 	while(!frontier.empty() && result.status != Result<state_t>::SUCCESS) {
-		Node<state_t> *node = frontier.front();
+		observer.begin(SELECTION);
+		node_t *node = frontier.front();
 		frontier.pop_front(), explored.push_back(node);
+		observer.end(SELECTION);
 
-		auto actions = problem.actions(node->state);
-		for(auto action : actions) {
-			Node<state_t> *child = child_node(node, action);
-			++result.expanded_nodes;
+		observer.begin(EXPANSION), observer.expanded();
+		expander.expand(node, arena, [&](node_t *child) -> bool {
+			++result.expanded_nodes, observer.generated();
 			if( contains_ptr_state(explored, child->state) || 
 				contains_ptr_state(frontier, child->state)) {
-				delete child;
-			} else {
-				if(problem.is_goal(child->state)) {
-					result = Result<state_t>(Result<state_t>::SUCCESS, child, result.expanded_nodes);
-					//delete child;
-					break;
-				}
-				frontier.push_back(child); // FIFO
+				arena.release(child), observer.pruned();
+				return true;
 			}
-		}
-		Utils::empty(actions);
+			if(problem.is_goal(child->state)) {
+				result = expander.result(Result<state_t>::SUCCESS, child, result.expanded_nodes);
+				return false;
+			}
+			frontier.push_back(child); // FIFO
+			return true;
+		});
+		observer.end(EXPANSION);
+		observer.frontier(frontier.size()), observer.memory(arena.size() * sizeof(node_t));
 	}
-	Utils::empty(frontier), Utils::empty(explored);
 
 	return result;
 }
 
+// Busca em grafo verificando estados repetidos em um conjunto indexado por
+// StateHash, que contém os estados da fronteira e os já explorados.
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> hashed_search_graph(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer) {
+	typedef typename expander_t::node_type node_t;
+
+	NodeArena<node_t> arena;
+	std::deque<node_t *> frontier(1, expander.root(arena));
+	if(problem.is_goal(problem.initial_state))
+		return expander.result(Result<state_t>::SUCCESS, frontier.front(), 1);
+
+	std::unordered_set<state_t, StateHash<state_t> > visited;
+	visited.insert(problem.initial_state);
+
+	Result<state_t> result(Result<state_t>::FAILURE, nullptr, frontier.size());
+
+	while(!frontier.empty() && result.status != Result<state_t>::SUCCESS) {
+		observer.begin(SELECTION);
+		node_t *node = frontier.front();
+		frontier.pop_front();
+		observer.end(SELECTION);
+
+		observer.begin(EXPANSION), observer.expanded();
+		expander.expand(node, arena, [&](node_t *child) -> bool {
+			++result.expanded_nodes, observer.generated();
+			if(!visited.insert(child->state).second) {
+				arena.release(child), observer.pruned();
+				return true;
+			}
+			if(problem.is_goal(child->state)) {
+				result = expander.result(Result<state_t>::SUCCESS, child, result.expanded_nodes);
+				return false;
+			}
+			frontier.push_back(child); // FIFO
+			return true;
+		});
+		observer.end(EXPANSION);
+		observer.frontier(frontier.size()), observer.memory(arena.size() * sizeof(node_t));
+	}
+
+	return result;
+}
+
+// Seleciona a implementação conforme a existência de StateHash para o estado.
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> search_graph(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer, std::false_type) {
+	return linear_search_graph(problem, expander, observer);
+}
+
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> search_graph(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer, std::true_type) {
+	return hashed_search_graph(problem, expander, observer);
+}
+
+// Busca em grafo síncrona por nível: a fronteira de cada nível é dividida em
+// fatias contíguas, expandidas em paralelo (cada thread com sua arena e sua
+// parte da próxima fronteira), e os estados repetidos são descartados em um
+// ConcurrentStateSet. As partes são concatenadas na ordem das fatias, o que
+// preserva a ordem FIFO entre níveis.
+//
+// Uma thread só interrompe sua fatia se um objetivo já tiver sido encontrado
+// em uma fatia anterior (ou nela mesma), e o objetivo retornado é o da
+// primeira fatia que encontrou algum. Todos pertencem ao mesmo nível, então a
+// profundidade da solução é a mesma da busca sequencial.
+template <class state_t, class expander_t>
+Result<state_t> parallel_search_graph(const Problem<state_t> &problem, const expander_t &expander,
+									  unsigned int num_workers, std::true_type) {
+	typedef typename expander_t::node_type node_t;
+
+	Utils::ThreadPool pool(num_workers);
+	std::deque<NodeArena<node_t> > arenas(num_workers); // nós vivem até o fim da busca
+	std::vector<node_t *> frontier(1, expander.root(arenas[0]));
+	if(problem.is_goal(problem.initial_state))
+		return expander.result(Result<state_t>::SUCCESS, frontier.front(), 1);
+
+	ConcurrentStateSet<state_t> visited;
+	visited.insert(problem.initial_state);
+
+	std::vector<std::vector<node_t *> > next(num_workers);
+	std::vector<node_t *> goals(num_workers);
+	std::vector<long unsigned int> generated(num_workers);
+	long unsigned int expanded_nodes = frontier.size();
+
+	while(!frontier.empty()) {
+		std::atomic<unsigned int> first_goal(num_workers); // fatia com objetivo
+		const std::size_t slice = (frontier.size() + num_workers - 1) / num_workers;
+
+		for(unsigned int w = 0; w < num_workers; ++w) {
+			next[w].clear(), goals[w] = nullptr, generated[w] = 0;
+
+			const std::size_t begin = w * slice;
+			const std::size_t end = std::min(begin + slice, frontier.size());
+			if(begin >= end) continue;
+
+			pool.submit([&, w, begin, end]() {
+				NodeArena<node_t> &arena = arenas[w];
+				for(std::size_t i = begin; i < end && first_goal.load() > w; ++i) {
+					expander.expand(frontier[i], arena, [&](node_t *child) -> bool {
+						++generated[w];
+						if(!visited.insert(child->state)) {
+							arena.release(child);
+							return true;
+						}
+						if(problem.is_goal(child->state)) {
+							goals[w] = child;
+							unsigned int found = first_goal.load();
+							while(found > w && !first_goal.compare_exchange_weak(found, w));
+							return false;
+						}
+						next[w].push_back(child); // FIFO
+						return true;
+					});
+				}
+			});
+		}
+		pool.wait();
+
+		for(unsigned int w = 0; w < num_workers; ++w) expanded_nodes += generated[w];
+		for(unsigned int w = 0; w < num_workers; ++w)
+			if(goals[w]) return expander.result(Result<state_t>::SUCCESS, goals[w], expanded_nodes);
+
+		frontier.clear();
+		for(unsigned int w = 0; w < num_workers; ++w)
+			frontier.insert(frontier.end(), next[w].begin(), next[w].end());
+	}
+
+	return Result<state_t>(Result<state_t>::FAILURE, nullptr, expanded_nodes);
+}
+
+// Sem StateHash não há como compartilhar o conjunto de visitados entre as
+// threads: a busca é sequencial.
+template <class state_t, class expander_t>
+Result<state_t> parallel_search_graph(const Problem<state_t> &problem, const expander_t &expander,
+									  unsigned int num_workers, std::false_type) {
+	if(num_workers == 0)
+		throw std::invalid_argument("Parallel search must have at least one worker.");
+	NullObserver observer;
+	return linear_search_graph(problem, expander, observer);
+}
+} // unnamed namespace
+
+/** Busca a solução do problema usando uma árvore (aceita nós com estados já
+ * visitados), informando os eventos da busca ao observador dado (ex:
+ * SearchStats).
+ *
+ * @param problem o problema a ser solucionado.
+ * @param observer [out] o observador da busca. */
+template <class state_t, class observer_t>
+Result<state_t> search_tree(const Problem<state_t> &problem, observer_t &observer) {
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return search_tree(problem, EncodedExpander<state_t, CompactNode<state_t> >(*encoded_problem), observer);
+	return search_tree(problem, ActionExpander<state_t, Node<state_t> >(problem), observer);
+}
+
+/** Busca a solução do problema usando uma árvore (aceita nós com estados já
+ * visitados).
+ *
+ * @param problem o problema a ser solucionado. */
+template <class state_t>
+Result<state_t> search_tree(const Problem<state_t> &problem) {
+	NullObserver observer;
+	return search_tree(problem, observer);
+}
+
+/** Busca a solução do problema usando um grafo (@em não aceita nós com estados
+ * já visitados), informando os eventos da busca ao observador dado (ex:
+ * SearchStats). O teste de objetivo é feito na geração dos filhos, portanto
+ * seu tempo está incluído na fase EXPANSION.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param observer [out] o observador da busca. */
+template <class state_t, class observer_t>
+Result<state_t> search_graph(const Problem<state_t> &problem, observer_t &observer) {
+	std::integral_constant<bool, StateHash<state_t>::enabled> hashed;
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return search_graph(problem, EncodedExpander<state_t, CompactNode<state_t> >(*encoded_problem), observer, hashed);
+	return search_graph(problem, ActionExpander<state_t, Node<state_t> >(problem), observer, hashed);
+}
+
+/** Busca a solução do problema usando um grafo (@em não aceita nós com estados
+ * já visitados). Se houver StateHash definido para o estado, a verificação de
+ * estados repetidos é feita em tempo constante (em média), caso contrário é
+ * linear no número de nós gerados. Se o problema for um EncodedProblem, os
+ * nós armazenam apenas o identificador da ação (CompactNode).
+ *
+ * @param problem o problema a ser solucionado. */
+template <class state_t>
+Result<state_t> search_graph(const Problem<state_t> &problem) {
+	NullObserver observer;
+	return search_graph(problem, observer);
+}
+
+/** Busca a solução do problema usando um grafo, como search_graph, mas
+ * expandindo cada nível da árvore de busca em paralelo: as <i>threads</i>
+ * expandem fatias da fronteira atual, descartam estados repetidos em um
+ * ConcurrentStateSet e compõem a fronteira do próximo nível.
+ *
+ * A solução tem a mesma profundidade (número de ações) da encontrada por
+ * search_graph, mas, havendo mais de um caminho mais curto, o caminho
+ * retornado e o número de nós gerados podem variar entre execuções. Se não
+ * houver StateHash definido para o estado, a busca é sequencial.
+ *
+ * @param problem o problema a ser solucionado.
+ * @param num_workers número de <i>threads</i> (> 0).
+ *
+ * @throws std::invalid_argument se num_workers for 0. */
+template <class state_t>
+Result<state_t> parallel_search_graph(const Problem<state_t> &problem,
+									  unsigned int num_workers = Utils::ThreadPool::hardware_workers()) {
+	std::integral_constant<bool, StateHash<state_t>::enabled> hashed;
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return parallel_search_graph(problem, EncodedExpander<state_t, CompactNode<state_t> >(*encoded_problem),
+									 num_workers, hashed);
+	return parallel_search_graph(problem, ActionExpander<state_t, Node<state_t> >(problem), num_workers, hashed);
+}
+
 /** Busca a solução do problema.
  *
  * @param problem o problema a ser solucionado.
@@ -8,6 +8,8 @@
 #ifndef IIA_SEARCH_UNINFORMED_DEPTH_LIMITED_H
 #define IIA_SEARCH_UNINFORMED_DEPTH_LIMITED_H
 
+#include "CompactSearchNode.hpp"
+#include "NodeExpander.hpp"
 #include "Problem.hpp"
 #include "SearchResult.hpp"
 
@@ -66,16 +68,80 @@ Result<state_t> recursive_search(Node<state_t> *node,
 
 	return result;
 }
+
+// Dados compartilhados pelos níveis da busca em um EncodedProblem.
+template <class state_t>
+struct Context {
+	const EncodedProblem<state_t> &problem;
+	Result<state_t> &result;
+	bool cutoff_occurred;
+};
+
+template <class state_t>
+bool encoded_search(Context<state_t> &context, CompactNode<state_t> *node, unsigned int limit);
+
+// Um nível da busca em um EncodedProblem: busca a partir de cada sucessor do
+// nó, até encontrar a solução.
+template <class state_t>
+class Probe : public SuccessorSink<state_t> {
+public:
+	Probe(Context<state_t> &c, CompactNode<state_t> *n, unsigned int l) : context(c), node(n), limit(l) {}
+
+	bool operator()(const state_t &successor, ActionId id, double cost) {
+		++context.result.expanded_nodes;
+		CompactNode<state_t> child(successor, node, id, node->path_cost + cost);
+		return !encoded_search(context, &child, limit);
+	}
+
+private:
+	Context<state_t> &context;
+	CompactNode<state_t> *node;
+	unsigned int limit;
+};
+
+/* Busca recursivamente uma solução partindo de um nó de um EncodedProblem, como
+ * recursive_search, gerando os sucessores por
+ * EncodedProblem::for_each_successor. Os nós ficam na pilha de chamadas, e
+ * nenhuma ação é alocada.
+ *
+ * @return true se a solução foi encontrada (e armazenada em context.result). */
+template <class state_t>
+bool encoded_search(Context<state_t> &context, CompactNode<state_t> *node, unsigned int limit) {
+	if(context.problem.is_goal(node->state)) {
+		context.result = Result<state_t>(Result<state_t>::SUCCESS, node, context.problem,
+										 context.result.expanded_nodes);
+		return true;
+	}
+
+	if(limit < 1) {
+		context.cutoff_occurred = true;
+		return false;
+	}
+
+	Probe<state_t> probe(context, node, limit - 1);
+	context.problem.for_each_successor(node->state, probe);
+	return (context.result.status == Result<state_t>::SUCCESS);
+}
 } // unnamed namespace
 
 /** Busca a solução do problema usando uma árvore (aceita nós com estados já
- * visitados).
+ * visitados). Se o problema for um EncodedProblem, os sucessores são gerados
+ * por EncodedProblem::for_each_successor, sem alocação de nós nem de ações.
  *
  * @param problem o problema a ser solucionado.
  * @param limit a profundidade máxima a procurar. */
 template <class state_t>
 Result<state_t> search(const Problem<state_t> &problem, 
 	const unsigned int limit) {
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem)) {
+		Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1); // contabilizar a raiz
+		Context<state_t> context = {*encoded_problem, result, false};
+		CompactNode<state_t> root(problem.initial_state);
+		if(!encoded_search(context, &root, limit) && context.cutoff_occurred)
+			result.status = Result<state_t>::CUTOFF;
+		return result;
+	}
+
 	Node<state_t> *node = new Node<state_t>(problem.initial_state);
 	Result<state_t> result = recursive_search(node, problem, limit);
 	++result.expanded_nodes; // contabilizar o nó criado por "new Node".
@@ -8,9 +8,10 @@
 #ifndef IIA_UNINFORMED_SEARCH_UNIFORM_COST_H
 #define IIA_UNINFORMED_SEARCH_UNIFORM_COST_H
 
-#include <algorithm>
-
+#include "NodeExpander.hpp"
 #include "Problem.hpp"
+#include "PriorityFrontier.hpp"
+#include "SearchObserver.hpp"
 #include "SearchResult.hpp"
 
 namespace IIA {
@@ -23,16 +24,85 @@ namespace Uninformed {
  * a raiz. */
 namespace UniformCost {
 namespace {
-// Compara os nós, indicando se o custo do caminho do primeiro argumento é menor
-// que o do segundo.
+// Compara os nós, indicando se o custo do caminho do primeiro argumento é maior
+// que o do segundo (i.e. se tem menor prioridade na fronteira).
 template <class node_t>
-bool compare_path_costs(const node_t *lhs, const node_t *rhs) {
-	return (lhs->path_cost < rhs->path_cost);
+struct HigherPathCost {
+	bool operator()(const node_t *lhs, const node_t *rhs) const {
+		return (lhs->path_cost > rhs->path_cost);
+	}
+};
+
+// Busca com o gerador de nós dado (ActionExpander ou EncodedExpander).
+template <class state_t, class expander_t, class observer_t>
+Result<state_t> search_with(const Problem<state_t> &problem, const expander_t &expander, observer_t &observer) {
+	typedef typename expander_t::node_type node_t;
+
+	PriorityFrontier<state_t, node_t, HigherPathCost<node_t> > frontier;
+	NodeArena<node_t> arena;
+	frontier.push(expander.root(arena));
+
+	typename StateSet<state_t>::type explored_states;
+
+	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
+	while(!frontier.empty()) {
+		observer.begin(SELECTION);
+		node_t *node = frontier.pop();
+		explored_states.insert(node->state);
+		observer.end(SELECTION);
+
+		observer.begin(GOAL_TEST);
+		const bool goal = problem.is_goal(node->state);
+		observer.end(GOAL_TEST);
+		if(goal) {
+			result = expander.result(Result<state_t>::SUCCESS, node, result.expanded_nodes);
+			break;
+		}
+
+		observer.begin(EXPANSION), observer.expanded();
+		expander.expand(node, arena, [&](node_t *child) -> bool {
+			result.expanded_nodes++, observer.generated();
+
+			if(explored_states.count(child->state)) {
+				arena.release(child), observer.pruned();
+				return true;
+			}
+
+			node_t *aux_node = frontier.find(child->state);
+			if(!aux_node)
+				frontier.push(child);
+			else if(child->path_cost < aux_node->path_cost)
+				arena.release(frontier.replace(child));
+			else
+				arena.release(child), observer.pruned();
+			return true;
+		});
+		observer.end(EXPANSION);
+		observer.frontier(frontier.size()), observer.memory(arena.size() * sizeof(node_t));
+	}
+
+	return result;
 }
 } // unnamed namespace
 
+/** Busca a solução do problema, como search(const Problem<state_t> &),
+ * informando os eventos da busca ao observador dado (ex: SearchStats).
+ *
+ * @param problem o problema a ser solucionado.
+ * @param observer [out] o observador da busca. */
+template <class state_t, class observer_t>
+Result<state_t> search(const Problem<state_t> &problem, observer_t &observer) {
+	if(const EncodedProblem<state_t> *encoded_problem = encoded(problem))
+		return search_with(problem, EncodedExpander<state_t, CompactNode<state_t> >(*encoded_problem), observer);
+	return search_with(problem, ActionExpander<state_t, Node<state_t> >(problem), observer);
+}
+
 /** Busca a solução do problema usando um grafo (@em não aceita nós com estados
- * já visitados).
+ * já visitados). A fronteira é um heap binário indexado por estado
+ * (PriorityFrontier), e o conjunto explorado é indexado por StateHash (se
+ * houver), portanto cada expansão custa O(log n). Os nós são criados em uma
+ * NodeArena, liberada ao final da busca; se o problema for um EncodedProblem,
+ * eles armazenam apenas o identificador da ação (CompactNode).
  *
  * @param problem o problema a ser solucionado.
  *
@@ -45,49 +115,8 @@ bool compare_path_costs(const node_t *lhs, const node_t *rhs) {
  * @endcode */
 template <class state_t>
 Result<state_t> search(const Problem<state_t> &problem) {
-	std::deque<Node<state_t> *> frontier(1, new Node<state_t>(problem.initial_state));
-	std::deque<Node<state_t> *> explored;
-
-	Result<state_t> result(Result<state_t>::FAILURE, nullptr, 1);
-	while(!frontier.empty()) {
-		std::sort(frontier.begin(), frontier.end(), compare_path_costs<Node<state_t> >);
-
-		Node<state_t> *node = frontier.front();
-
-		frontier.pop_front();
-		explored.push_back(node);
-
-		if(problem.is_goal(node->state)) {
-			result = Result<state_t>(Result<state_t>::SUCCESS, node, result.expanded_nodes);
-			break;
-		}
-
-		std::deque<Action<state_t> *> actions = problem.actions(node->state);
-		for(Action<state_t> *action : actions) {
-			Node<state_t> *child = child_node(node, action);
-			result.expanded_nodes++;
-			if(!contains_ptr_state(frontier, child->state)) {
-				if(!contains_ptr_state(explored, child->state)) {
-					frontier.push_back(child);
-				} else delete child;
-			} else {
-				for(Node<state_t> *aux_node : frontier) {
-					if(child->state == aux_node->state && child->path_cost < aux_node->path_cost) {
-						/** @todo verificar onde mais child está sendo deletada (delete aqui leva a "double free or corruption (out)" */
-						*aux_node = *child;
-						//delete child;
-						break;
-					}
-				}
-			}
-		}
-		Utils::empty(actions);
-	}
-
-	Utils::empty(frontier);
-	Utils::empty(explored);
-
-	return result;
+	NullObserver observer;
+	return search(problem, observer);
 }
 } // namespace UniformCost
 } // namespace Uninformed
@@ -12,6 +12,7 @@
 #include <stdexcept>
 
 #include "Action.hpp"
+#include "NodeArena.hpp"
 #include "Utils.h"
 
 namespace IIA {
@@ -98,6 +99,25 @@ Node<state_t> *child_node(Node<state_t> *parent, Action<state_t> *action) {
 	return node;
 }
 
+/** Retorna a referência para um novo nó, criado na arena dada, como filho da
+ * instância, resultante da execução da ação dada como argumento.
+ *
+ * @param parent o nó pai da nova instância.
+ * @param action ação que origina o novo nó.
+ * @param arena a arena onde o nó é criado (e que é dona do nó). */
+template <class state_t>
+Node<state_t> *child_node(Node<state_t> *parent, Action<state_t> *action, NodeArena<Node<state_t> > &arena) {
+	if(!parent)
+		throw std::invalid_argument("Child node must have a parent.");
+	if(!action)
+		throw std::invalid_argument("Child node must result from an action.");
+
+	Node<state_t> *node = arena.create(parent->state, parent, action, parent->path_cost + action->cost);
+	action->execute(node->state);
+
+	return node;
+}
+
 /** Retorna os nós resultantes da execução das ações fornecidas no estado do nó
  * dado.
  *
@@ -8,6 +8,12 @@
 #ifndef IIA_STATE_HPP
 #define IIA_STATE_HPP
 
+#include <cstddef> // std::size_t
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace IIA {
 /** Força a definição da função de atribuição para a classe. */
 template <class class_t>
@@ -75,6 +81,73 @@ public:
 template <class state_t>
 class State : public Assignable<state_t>, public Comparable<state_t> {};
 
+/** Define a função de espalhamento (<i>hash</i>) de um estado, nos moldes de
+ * std::hash. Por padrão um estado não a possui (<i>enabled</i> é falso) e as
+ * buscas verificam estados repetidos percorrendo seus containers. Para que a
+ * verificação seja feita em tempo constante (em média), basta especializar o
+ * template para o estado.
+ *
+ * Exemplo de implementação:
+ * @code
+ * namespace IIA {
+ * template <>
+ * struct StateHash<Integer> {
+ * 	static const bool enabled = true;
+ * 	std::size_t operator()(const Integer &state) const {
+ * 		return state.number;
+ * 	}
+ * };
+ * } // namespace IIA
+ * @endcode */
+template <class state_t>
+struct StateHash {
+	/** Indica se há função de espalhamento definida para o estado. */
+	static const bool enabled = false;
+};
+
+/** Mistura os bits do valor de espalhamento dado. Funções de StateHash
+ * simples (como a identidade) são adequadas para tabelas, mas concentrariam
+ * os estados se apenas alguns bits fossem usados para distribuí-los (ex:
+ * entre partições ou <i>threads</i>). */
+inline std::size_t spread_hash(std::size_t h) {
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/** Seleciona o tipo de conjunto de estados: indexado por StateHash, se houver,
+ * ou ordenado (pelo operador <) caso contrário. Uso:
+ * <code>typename StateSet<state_t>::type visited;</code> */
+template <class state_t, bool hashed = StateHash<state_t>::enabled>
+struct StateSet {
+	/** Conjunto ordenado. */
+	typedef std::set<state_t> type;
+};
+
+/** Especialização de StateSet para estados com StateHash. */
+template <class state_t>
+struct StateSet<state_t, true> {
+	/** Conjunto indexado por StateHash. */
+	typedef std::unordered_set<state_t, StateHash<state_t> > type;
+};
+
+/** Seleciona o tipo de mapeamento de estados em valores: indexado por
+ * StateHash, se houver, ou ordenado (pelo operador <) caso contrário. Uso:
+ * <code>typename StateMap<state_t, Node<state_t> *>::type closed;</code> */
+template <class state_t, class value_t, bool hashed = StateHash<state_t>::enabled>
+struct StateMap {
+	/** Mapeamento ordenado. */
+	typedef std::map<state_t, value_t> type;
+};
+
+/** Especialização de StateMap para estados com StateHash. */
+template <class state_t, class value_t>
+struct StateMap<state_t, value_t, true> {
+	/** Mapeamento indexado por StateHash. */
+	typedef std::unordered_map<state_t, value_t, StateHash<state_t> > type;
+};
+
 namespace { // State
 /** Verifica se o container dado contém o estado. O primeiro argumento deve ser
  * iterável. */
@@ -0,0 +1,90 @@
+/** @file Mailbox.h
+ *
+ * Definição de uma caixa de mensagens sem travas (@em lock-free) para troca
+ * de dados entre <i>threads</i>.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_UTILS_MAILBOX_H
+#define IIA_UTILS_MAILBOX_H
+
+#include <atomic>
+#include <utility>
+
+namespace IIA {
+namespace Utils {
+/** Caixa de mensagens com vários remetentes e um único destinatário. As
+ * mensagens são empilhadas com uma operação atômica (compare-and-swap), e o
+ * destinatário retira todas de uma só vez, então nenhuma operação bloqueia.
+ * A ordem de recebimento não é garantida.
+ *
+ * send() pode ser chamado por qualquer <i>thread</i>; receive() e empty()
+ * apenas pela dona da caixa.
+ *
+ * Exemplo de uso:
+ * @code
+ * IIA::Utils::Mailbox<int> mailbox;
+ * mailbox.send(42); // em outra thread
+ * mailbox.receive([](int &value) { std::cout << value; });
+ * @endcode */
+template <class message_t>
+class Mailbox {
+public:
+	/** Construtor. */
+	Mailbox() : head(nullptr) {}
+
+	/** Destrutor. Descarta as mensagens não recebidas. */
+	~Mailbox() {
+		release(head.load());
+	}
+
+	/** Envia a mensagem dada. */
+	void send(message_t message) {
+		Cell *cell = new Cell(std::move(message), head.load(std::memory_order_relaxed));
+		while(!head.compare_exchange_weak(cell->next, cell, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	/** Retira todas as mensagens da caixa, repassando cada uma a receiver.
+	 * Retorna o número de mensagens recebidas. */
+	template <class receiver_t>
+	unsigned int receive(receiver_t receiver) {
+		if(!head.load(std::memory_order_relaxed)) return 0;
+
+		Cell *cells = head.exchange(nullptr, std::memory_order_acquire);
+		unsigned int n = 0;
+		for(Cell *cell = cells; cell; cell = cell->next, ++n)
+			receiver(cell->message);
+		release(cells);
+		return n;
+	}
+
+	/** Indica se não há mensagens na caixa. */
+	bool empty() const { return !head.load(std::memory_order_acquire); }
+
+private:
+	struct Cell {
+		Cell(message_t &&m, Cell *n) : message(std::move(m)), next(n) {}
+
+		message_t message;
+		Cell *next;
+	};
+
+	Mailbox(const Mailbox &);
+	Mailbox &operator=(const Mailbox &);
+
+	static void release(Cell *cells) {
+		while(cells) {
+			Cell *next = cells->next;
+			delete cells;
+			cells = next;
+		}
+	}
+
+	// Attributes
+	std::atomic<Cell *> head;
+};
+} // namespace Utils
+} // namespace IIA
+
+#endif // IIA_UTILS_MAILBOX_H
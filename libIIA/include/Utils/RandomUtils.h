@@ -13,59 +13,124 @@
 
 namespace IIA {
 namespace Utils {
-/** Define o escopo de funções auxiliares relacionadas a números aleatórios. A 
- * obtenção dos números é baseada neste
- * <a href="http://www.codeproject.com/KB/recipes/SimpleRNG.aspx">artigo</a>.
- * Eis a descrição original: <i>SimpleRNG is a simple random number generator
- * based on George Marsaglia's MWC (multiply with carry) generator. Although it
- * is very simple, it passes Marsaglia's DIEHARD series of random number
- * generator tests.
+/** Define o escopo de funções auxiliares relacionadas a números aleatórios.
  *
- * Written by John D. Cook http://www.johndcook.com</i>*/
+ * Os números são obtidos de um Generator, que implementa o algoritmo
+ * <a href="http://prng.di.unimi.it/">xoshiro256**</a> (Blackman e Vigna).
+ * Cada instância tem seu próprio estado, então pode ser usada por
+ * <i>thread</i> ou por partida. As funções livres (get_random_int(), etc.)
+ * usam o gerador da <i>thread</i> corrente (thread_generator()), portanto
+ * podem ser chamadas concorrentemente. */
 namespace Random {
-namespace {
-namespace {
-// These values are not magical, just the default values Marsaglia used.
-// Any pair of unsigned integers should be fine.
-static uint64_t m_w = 521288629; // semente aleatória
-static uint64_t m_z = 362436069; // semente aleatória
+/** Gerador de números pseudo-aleatórios xoshiro256**. O estado (256 bits) é
+ * inicializado com <a href="http://xorshift.di.unimi.it/splitmix64.c">SplitMix64</a>
+ * a partir de um par (semente, fluxo): a mesma semente com fluxos diferentes
+ * (por exemplo, a semente de um campeonato e o identificador de cada partida)
+ * produz sequências independentes e reprodutíveis.
+ *
+ * Satisfaz os requisitos de <i>UniformRandomBitGenerator</i>, então pode ser
+ * usado com std::shuffle e as distribuições de &lt;random&gt;. */
+class Generator {
+public:
+	/** Tipo dos números gerados. */
+	typedef uint64_t result_type;
 
-/** Retorna um número inteiro aleatório e positivo. */
-unsigned int get_uint() {
-	/** A descrição original diz: <i>This is the heart
-	 * of the generator. It uses George Marsaglia's MWC algorithm to produce an
-	 * unsigned integer.
-	 * See http://www.bobwheeler.com/statistics/Password/MarsagliaPost.txt</i>*/
-
-	m_z = 36969 * (m_z & 65535) + (m_z >> 16);
-	m_w = 18000 * (m_w & 65535) + (m_w >> 16);
-	return (m_z << 16) + m_w;
-}
+	/** Cria o gerador com a semente e o fluxo dados. */
+	explicit Generator(uint64_t seed = 0x853c49e6748fea9bULL, /**< [in] semente */
+					   uint64_t stream = 0 					  /**< [in] fluxo */) {
+		set_seed(seed, stream);
+	}
 
-/** Retorna um número aleatório entre 0 e 1 (exclusive). */
-double get_uniform() {
-	/** A descrição original diz: <i>Produce a uniform random sample from the
-	 * open interval (0, 1). The method will not return either end point.</i> */
-
-	// 0 <= u < 2^32
-	unsigned int u = get_uint();
-	// The magic number below is 1/(2^32 + 2).
-	// The result is strictly between 0 and 1.
-	//return (u + 1.0) * 2.328306435454494e-10;
-	constexpr double magicNumber = 2.328306435454494e-10;
-	return u * magicNumber;
-}
+	/** Reinicia o gerador com a semente e o fluxo dados. */
+	void set_seed(uint64_t seed, uint64_t stream = 0) {
+		// mix() é uma bijeção, então fluxos diferentes geram estados diferentes
+		uint64_t x = seed ^ mix(stream + GOLDEN_GAMMA);
+		for(int i = 0; i < 4; ++i)
+			x += GOLDEN_GAMMA, state[i] = mix(x);
+	}
+
+	/** Retorna o próximo número da sequência (64 bits). */
+	result_type operator()() {
+		const uint64_t result = rotl(state[1] * 5, 7) * 9;
+		const uint64_t t = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+
+		return result;
+	}
+
+	/** Menor valor gerado. */
+	static constexpr result_type min() { return 0; }
+	/** Maior valor gerado. */
+	static constexpr result_type max() { return ~result_type(0); }
+
+	/** Retorna um número inteiro aleatório e positivo (32 bits). */
+	unsigned int get_uint() { return (*this)() >> 32; }
+
+	/** Retorna um número aleatório entre 0 (inclusive) e 1 (exclusive). */
+	double get_uniform() {
+		constexpr double two_to_minus_53 = 1.0 / 9007199254740992.0;
+		return ((*this)() >> 11) * two_to_minus_53;
+	}
 
-/** Define a semente que inicializa a sequência de números aleatórios. */
-void set_seed(uint64_t u, uint64_t v) {
-	/** A descrição original diz: <i>The random generator seed can be set three ways:
-	 * 1) specifying two non-zero unsigned integers
-	 * 2) specifying one non-zero unsigned integer and taking a default value for the second
-	 * 3) setting the seed from the system time </i> */
+	/** Retorna um número aleatório entre os limites dados (inclusive).
+	 *
+	 * @param u_bound Limite superior;
+	 * @param l_bound Limite inferior. */
+	int get_random_int(int u_bound = 10, int l_bound = 0) {
+		// multiplicação em vez de módulo (Lemire): sem divisão
+		const uint64_t range = uint64_t(int64_t(u_bound) - l_bound + 1);
+		return int(int64_t(l_bound) + int64_t((uint64_t(get_uint()) * range) >> 32));
+	}
 
-	if(u != 0) m_w = u;
-	if(v != 0) m_z = v;
+	/** Retorna um número aleatório entre os limites dados (inclusive).
+	 *
+	 * @param u_bound Limite superior;
+	 * @param l_bound Limite inferior. */
+	double get_random_dbl(double u_bound = 1, double l_bound = 0) {
+		return get_uniform() * (u_bound - l_bound) + l_bound;
+	}
+
+private:
+	static constexpr uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+	static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+	// Função de finalização do SplitMix64.
+	static uint64_t mix(uint64_t z) {
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		return z ^ (z >> 31);
+	}
+
+	// Attributes
+	uint64_t state[4];
+};
+
+/** Retorna o gerador da <i>thread</i> corrente. Há uma única instância por
+ * <i>thread</i> no programa todo (e não por unidade de tradução); ao ser
+ * criada, todas usam a mesma semente padrão. */
+inline Generator &thread_generator() {
+	static thread_local Generator generator;
+	return generator;
 }
+
+namespace {
+namespace {
+/** Retorna um número inteiro aleatório e positivo. */
+unsigned int get_uint() { return thread_generator().get_uint(); }
+
+/** Retorna um número aleatório entre 0 (inclusive) e 1 (exclusive). */
+double get_uniform() { return thread_generator().get_uniform(); }
+
+/** Define a semente (e o fluxo) que inicializa a sequência de números
+ * aleatórios da <i>thread</i> corrente. */
+void set_seed(uint64_t u, uint64_t v) { thread_generator().set_seed(u, v); }
 } // unnamed namespace
 
 /** Inicializa a semente de números aleatórios a partir do relógio da  CPU
@@ -81,7 +146,7 @@ void set_seed_from_system_time() {
  * @param u_bound Limite superior;
  * @param l_bound Limite inferior. */
 int get_random_int(int u_bound = 10, int l_bound = 0) {
-	return (get_uint() % (u_bound - l_bound + 1)) + l_bound;
+	return thread_generator().get_random_int(u_bound, l_bound);
 }
 
 /** Retorna um número aleatório entre os limites dados (inclusive).
@@ -89,7 +154,7 @@ int get_random_int(int u_bound = 10, int l_bound = 0) {
  * @param u_bound Limite superior;
  * @param l_bound Limite inferior. */
 double get_random_dbl(double u_bound = 1, double l_bound = 0) {
-	return get_uniform() * (u_bound - l_bound) + l_bound;
+	return thread_generator().get_random_dbl(u_bound, l_bound);
 }
 } // unnamed namespace
 } // namespace Random
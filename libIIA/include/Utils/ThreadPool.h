@@ -0,0 +1,140 @@
+/** @file ThreadPool.h
+ *
+ * Definição de um conjunto de <i>threads</i> para execução de tarefas
+ * independentes.
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#ifndef IIA_UTILS_THREAD_POOL_H
+#define IIA_UTILS_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace IIA {
+namespace Utils {
+/** Executa tarefas (funções sem argumentos nem retorno) em um número fixo de
+ * <i>threads</i>. As tarefas são retiradas de uma fila única na ordem em que
+ * foram submetidas; wait() bloqueia até que todas tenham terminado.
+ *
+ * Se alguma tarefa lançar uma exceção, a primeira delas é relançada por
+ * wait() (as demais tarefas continuam sendo executadas).
+ *
+ * Exemplo de uso:
+ * @code
+ * IIA::Utils::ThreadPool pool(4);
+ * for(Match *match : matches)
+ *     pool.submit([match]() { match->play(); });
+ * pool.wait();
+ * @endcode */
+class ThreadPool {
+public:
+	/** Tipo das tarefas executadas. */
+	typedef std::function<void()> Task;
+
+	/** Cria o conjunto com o número de <i>threads</i> dado. */
+	explicit ThreadPool(unsigned int num_workers /**< [in] número de threads (> 0) */)
+		: pending(0), stopping(false) {
+		if(num_workers == 0)
+			throw std::invalid_argument("ThreadPool must have at least one worker.");
+
+		workers.reserve(num_workers);
+		for(unsigned int i = 0; i < num_workers; ++i)
+			workers.push_back(std::thread(&ThreadPool::work, this));
+	}
+
+	/** Aguarda as tarefas pendentes e encerra as <i>threads</i>. */
+	~ThreadPool() {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		task_available.notify_all();
+		for(std::thread &worker : workers)
+			worker.join();
+	}
+
+	/** Acrescenta a tarefa dada à fila de execução. */
+	void submit(const Task &task) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			tasks.push_back(task);
+			++pending;
+		}
+		task_available.notify_one();
+	}
+
+	/** Bloqueia até que todas as tarefas submetidas tenham terminado. Relança
+	 * a primeira exceção lançada por uma tarefa desde a última chamada. */
+	void wait() {
+		std::unique_lock<std::mutex> lock(mutex);
+		all_done.wait(lock, [this]() { return pending == 0; });
+
+		if(error) {
+			std::exception_ptr e = error;
+			error = std::exception_ptr();
+			std::rethrow_exception(e);
+		}
+	}
+
+	/** Retorna o número de <i>threads</i>. */
+	unsigned int size() const { return workers.size(); }
+
+	/** Retorna o número de <i>threads</i> que o sistema executa
+	 * simultaneamente (no mínimo 1). */
+	static unsigned int hardware_workers() {
+		unsigned int n = std::thread::hardware_concurrency();
+		return (n ? n : 1);
+	}
+
+private:
+	ThreadPool(const ThreadPool &);
+	ThreadPool &operator=(const ThreadPool &);
+
+	// Laço de cada thread: executa tarefas até o encerramento.
+	void work() {
+		while(true) {
+			Task task;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				task_available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+				if(tasks.empty()) return; // stopping
+				task = tasks.front();
+				tasks.pop_front();
+			}
+
+			std::exception_ptr task_error;
+			try {
+				task();
+			} catch(...) {
+				task_error = std::current_exception();
+			}
+
+			std::unique_lock<std::mutex> lock(mutex);
+			if(task_error && !error) error = task_error;
+			if(--pending == 0) all_done.notify_all();
+		}
+	}
+
+	// Attributes
+	std::vector<std::thread> workers;
+	std::deque<Task> tasks;
+	std::size_t pending; // submetidas e ainda não terminadas
+	bool stopping;
+	std::exception_ptr error;
+
+	std::mutex mutex;
+	std::condition_variable task_available;
+	std::condition_variable all_done;
+};
+} // namespace Utils
+} // namespace IIA
+
+#endif	/* IIA_UTILS_THREAD_POOL_H */
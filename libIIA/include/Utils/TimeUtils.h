@@ -47,6 +47,17 @@ void get_cpu_time(timespec &time /**< variável para armazenar o tempo */) {
 	    throw std::runtime_error("Unable to get clock time.");*/
 }
 
+/** Marca, no argumento dado, o tempo de CPU consumido pela <i>thread</i>
+ * corrente (e não pelo processo todo), o que permite medir o custo de uma
+ * tarefa executada concorrentemente com outras. */
+void get_thread_cpu_time(timespec &time /**< variável para armazenar o tempo */) {
+#ifdef __MACH__
+	get_cpu_time(time);
+#else
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+#endif
+}
+
 /** Calcula o tempo passado entre os argumentos dados. */
 timespec time_diff(const timespec &start_time, /**< tempo inicial */
 				   const timespec &end_time    /**< tempo final */) {
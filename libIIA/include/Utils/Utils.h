@@ -8,6 +8,7 @@
 #ifndef IIA_UTILS_H
 #define IIA_UTILS_H
 
+#include <cstddef> // std::size_t
 #include <map>
 #include <set>
 // #include <sstream>
@@ -39,6 +40,13 @@ void empty(std::map<K, T *> &container) {
 	container.clear();
 }
 
+/** Combina o valor de espalhamento dado à semente, permitindo calcular o
+ * <i>hash</i> de estruturas com vários atributos (mesma ideia de
+ * boost::hash_combine). */
+inline std::size_t hash_combine(std::size_t seed, std::size_t value) {
+	return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
 /** Verifica se o container dado contem o item. O primeiro argumento deve ser
  * iterável. */
 template <class container_t, class type_t>
@@ -14,6 +14,7 @@
 #include "Problem.hpp"
 #include "Search/Informed/InformedSearch.h"
 #include "Search//Local/LocalSearch.h"
+#include "Search/SearchObserver.hpp"
 #include "Search/SearchResult.hpp"
 #include "Search/Uninformed/UninformedSearch.h"
 #include "State.hpp"
@@ -0,0 +1,72 @@
+/** @file TestAStarSearch.cpp
+ *
+ * Implementa testes para a classe IIA::Search::Informed::AStar
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <cstdlib> // abs
+#include <limits>
+
+#include "../../TestProblem.h"
+#include "AStarSearch.h"
+
+typedef IIA::Test::State::Integer Integer;
+typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+using IIA::Test::Problem::check_solution;
+
+namespace IIA {
+namespace Search {
+namespace Informed {
+/** Heurística inconsistente (distância até o objetivo mais próximo). */
+class DistanceHeuristic :  public HeuristicCalc<Integer> {
+public:
+	DistanceHeuristic(const std::set<Integer> *goal_states) : HeuristicCalc<Integer>(goal_states) {}
+
+	double eval(const Integer &state) const {
+		int minimum = std::numeric_limits<int>::max();
+		for(const Integer &number : *goals)
+			minimum = std::min(minimum, abs(number.number - state.number));
+		return minimum;
+	}
+};
+} // namespace Informed
+} // namespace Search
+} // namespace IIA
+
+using namespace IIA::Search;
+
+int main(int argc, char **argv)	{
+	ZeroToFour problem;
+
+	// h = 0 é admissível: a solução deve ser ótima (+1, +1, *2).
+	Informed::HeuristicCalc<Integer> zero(&problem.goal_states);
+	Result<Integer> result = Informed::AStar::search(problem, zero);
+	assert(check_solution(problem, result) == 1.75);
+
+	Informed::AStar::Counters counters;
+	result = Informed::AStar::search(problem, zero, Informed::AStar::LOWER_G, 0, &counters);
+	assert(check_solution(problem, result) == 1.75);
+	assert(counters.expanded_nodes > 0);
+	assert(counters.generated_nodes + 1 == result.expanded_nodes);
+
+	Informed::DistanceHeuristic distance(&problem.goal_states);
+	result = Informed::AStar::search(problem, distance, Informed::AStar::HIGHER_G, 0, &counters);
+	check_solution(problem, result);
+
+	// nós compactos
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	Informed::AStar::Counters plain, compact;
+	Informed::AStar::search(problem, zero, Informed::AStar::LOWER_G, 0, &plain);
+	result = Informed::AStar::search(encoded, zero, Informed::AStar::LOWER_G, 0, &compact);
+	assert(check_solution(encoded, result) == 1.75);
+	assert(compact.generated_nodes == plain.generated_nodes);
+
+	// limite de memória
+	result = Informed::AStar::search(problem, zero, Informed::AStar::HIGHER_G, 2);
+	assert(result.status == Result<Integer>::CUTOFF);
+	assert(result.actions.empty());
+
+	return 0;
+}
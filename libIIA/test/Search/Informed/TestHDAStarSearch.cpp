@@ -0,0 +1,72 @@
+/** @file TestHDAStarSearch.cpp
+ *
+ * Implementa testes para a classe IIA::Search::Informed::HDAStar
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <stdexcept>
+
+#include "../../TestProblem.h"
+#include "HDAStarSearch.h"
+
+typedef IIA::Test::State::Integer Integer;
+typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+typedef IIA::Test::Problem::ZeroToThousand ZeroToThousand;
+using IIA::Test::Problem::check_solution;
+
+namespace IIA {
+namespace Search {
+namespace Informed {
+/** Heurística admissível: fora do objetivo, resta ao menos uma ação, de custo
+ * mínimo 0.5. */
+class StepHeuristic : public HeuristicCalc<Integer> {
+public:
+	StepHeuristic(const std::set<Integer> *goal_states) : HeuristicCalc<Integer>(goal_states) {}
+
+	double eval(const Integer &state) const {
+		return (goals->count(state) ? 0 : 0.5);
+	}
+};
+} // namespace Informed
+} // namespace Search
+} // namespace IIA
+
+using namespace IIA::Search;
+
+// Com qualquer número de threads, a solução tem o mesmo custo (ótimo) que a
+// de A*.
+void test_search(const IIA::Problem<Integer> &problem, const Informed::HeuristicCalc<Integer> &h_calc) {
+	const double optimal = check_solution(problem, Informed::AStar::search(problem, h_calc));
+	for(unsigned int workers : {1, 2, 3, 8}) {
+		Informed::AStar::Counters counters;
+		Result<Integer> result = Informed::HDAStar::search(problem, h_calc, workers, &counters);
+		assert(check_solution(problem, result) == optimal);
+		assert(counters.expanded_nodes > 0);
+		assert(counters.generated_nodes + 1 == result.expanded_nodes);
+	}
+}
+
+int main(int argc, char **argv)	{
+	ZeroToFour problem;
+	Informed::HeuristicCalc<Integer> zero(&problem.goal_states);
+	test_search(problem, zero);
+
+	// nós compactos
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	test_search(encoded, zero);
+	assert(check_solution(encoded, Informed::HDAStar::search(encoded, zero)) == 1.75);
+
+	ZeroToThousand thousand;
+	Informed::StepHeuristic step(&thousand.goal_states);
+	test_search(thousand, zero);
+	test_search(thousand, step);
+
+	try {
+		Informed::HDAStar::search(problem, zero, 0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	return 0;
+}
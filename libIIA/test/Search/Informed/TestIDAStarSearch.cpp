@@ -0,0 +1,54 @@
+/** @file TestIDAStarSearch.cpp
+ *
+ * Implementa testes para a classe IIA::Search::Informed::IDAStar
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <stdexcept>
+
+#include "../../TestProblem.h"
+#include "IDAStarSearch.h"
+
+typedef IIA::Test::State::Integer Integer;
+typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+using IIA::Test::Problem::check_solution;
+
+using namespace IIA::Search;
+
+int main(int argc, char **argv)	{
+	ZeroToFour problem;
+
+	// h = 0 é admissível: a solução deve ser ótima (+1, +1, *2).
+	Informed::HeuristicCalc<Integer> zero(&problem.goal_states);
+	Result<Integer> result = Informed::IDAStar::search(problem, zero);
+	assert(check_solution(problem, result) == 1.75);
+
+	// a tabela de transposição poda estados repetidos sem perder a otimalidade
+	Result<Integer> pruned = Informed::IDAStar::search(problem, zero, 1024);
+	assert(check_solution(problem, pruned) == 1.75);
+	assert(pruned.expanded_nodes <= result.expanded_nodes);
+
+	// uma única entrada apenas reduz a poda
+	pruned = Informed::IDAStar::search(problem, zero, 1);
+	assert(check_solution(problem, pruned) == 1.75);
+
+	// problema codificado: mesma busca, sem alocação de ações
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	result = Informed::IDAStar::search(problem, zero);
+	Result<Integer> compact = Informed::IDAStar::search(encoded, zero);
+	assert(check_solution(encoded, compact) == 1.75);
+	assert(compact.actions.size() == result.actions.size());
+	assert(compact.expanded_nodes == result.expanded_nodes);
+
+	compact = Informed::IDAStar::search(encoded, zero, 1024);
+	assert(check_solution(encoded, compact) == 1.75);
+
+	try {
+		Informed::IDAStar::search(problem, zero, 0);
+		assert(false);
+	} catch(std::invalid_argument &e) {}
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/** @file TestArena.cpp
+ * 
+ * Implementa testes para a classe IIA::Search::NodeArena.
+ * 
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+
+#include "../TestProblem.h"
+#include "NodeArena.hpp"
+#include "SearchResult.hpp"
+
+using namespace IIA::Search;
+typedef IIA::Test::State::Integer Integer;
+typedef Uninformed::Node<Integer> Node;
+
+// Conta as instâncias existentes, para verificar a destruição dos nós.
+struct Counted {
+	Counted(int v) : value(v) { ++alive; }
+	~Counted() { --alive; }
+	int value;
+	static int alive;
+};
+int Counted::alive = 0;
+
+void test_create_clear() {
+	NodeArena<Counted> arena(3);
+	for(int i = 0; i < 10; ++i)
+		assert(arena.create(i)->value == i);
+	assert(arena.size() == 10);
+	assert(Counted::alive == 10);
+
+	arena.clear();
+	assert(arena.size() == 0);
+	assert(Counted::alive == 0);
+
+	// os blocos são reaproveitados
+	for(int i = 0; i < 4; ++i) arena.create(i);
+	assert(Counted::alive == 4);
+}
+
+void test_release() {
+	{
+		NodeArena<Counted> arena(2);
+		Counted *first = arena.create(1), *second = arena.create(2);
+		arena.release(first); // não é o último: permanece até clear()
+		assert(Counted::alive == 2);
+
+		arena.release(second);
+		assert(Counted::alive == 1);
+		assert(arena.create(3) == second); // memória reaproveitada
+	}
+	assert(Counted::alive == 0);
+}
+
+void test_child_node() {
+	NodeArena<Node> arena;
+	Node *root = arena.create(Integer(0));
+	IIA::Test::Action::Add add(1);
+	Node *child = Uninformed::child_node(root, &add, arena);
+	assert(child->parent == root);
+	assert(child->state == Integer(1));
+	assert(child->path_cost == add.cost);
+
+	try {
+		Uninformed::child_node(root, (IIA::Action<Integer> *)nullptr, arena);
+		assert(false);
+	} catch(std::invalid_argument &e) {}
+
+	// o resultado não depende dos nós da arena
+	Result<Integer> result(Result<Integer>::SUCCESS, child, arena.size());
+	arena.clear();
+	assert(result.actions.size() == 1);
+}
+
+int main(int argc, char **argv)	{
+	test_create_clear();
+	test_release();
+	test_child_node();
+	try {
+		NodeArena<Node> arena(0);
+		assert(false);
+	} catch(std::invalid_argument &e) {}
+
+	return 0;
+}
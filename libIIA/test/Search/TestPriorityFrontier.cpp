@@ -0,0 +1,89 @@
+/** @file TestPriorityFrontier.cpp
+ * 
+ * Implementa testes para a classe IIA::Search::PriorityFrontier.
+ * 
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+
+#include "../TestProblem.h"
+#include "PriorityFrontier.hpp"
+#include "SearchResult.hpp"
+
+using namespace IIA::Search;
+typedef IIA::Test::State::Integer Integer;
+typedef Uninformed::Node<Integer> Node;
+
+// Nó de menor custo tem maior prioridade.
+struct HigherPathCost {
+	bool operator()(const Node *lhs, const Node *rhs) const {
+		return lhs->path_cost > rhs->path_cost;
+	}
+};
+typedef PriorityFrontier<Integer, Node, HigherPathCost> Frontier;
+
+void test_push_pop() {
+	Frontier frontier;
+	assert(frontier.empty());
+
+	Node n1(Integer(1), nullptr, nullptr, 5), n2(Integer(2), nullptr, nullptr, 1),
+	     n3(Integer(3), nullptr, nullptr, 3), n4(Integer(4), nullptr, nullptr, 4);
+	frontier.push(&n1), frontier.push(&n2), frontier.push(&n3), frontier.push(&n4);
+	assert(frontier.size() == 4);
+	assert(frontier.top() == &n2);
+
+	Node same(Integer(3), nullptr, nullptr, 0);
+	try {
+		frontier.push(&same);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	assert(frontier.find(Integer(3)) == &n3);
+	assert(frontier.find(Integer(5)) == nullptr);
+
+	assert(frontier.pop() == &n2);
+	assert(frontier.pop() == &n3);
+	assert(frontier.pop() == &n4);
+	assert(frontier.pop() == &n1);
+	assert(frontier.empty());
+	assert(frontier.find(Integer(1)) == nullptr);
+
+	try {
+		frontier.pop();
+		assert(false);
+	} catch(std::out_of_range e) {}
+}
+
+void test_replace_update() {
+	Frontier frontier;
+	Node n1(Integer(1), nullptr, nullptr, 5), n2(Integer(2), nullptr, nullptr, 2),
+	     n3(Integer(3), nullptr, nullptr, 3);
+	frontier.push(&n1), frontier.push(&n2), frontier.push(&n3);
+
+	// "decrease-key" substituindo o nó
+	Node better(Integer(1), nullptr, nullptr, 1);
+	assert(frontier.replace(&better) == &n1);
+	assert(frontier.size() == 3);
+	assert(frontier.find(Integer(1)) == &better);
+	assert(frontier.top() == &better);
+
+	// alteração da prioridade do próprio nó
+	n3.path_cost = 0;
+	frontier.update(&n3);
+	assert(frontier.pop() == &n3);
+	assert(frontier.pop() == &better);
+	assert(frontier.pop() == &n2);
+
+	try {
+		frontier.update(&n3);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+}
+
+int main(int argc, char **argv) {
+	test_push_pop();
+	test_replace_update();
+
+	return 0;
+}
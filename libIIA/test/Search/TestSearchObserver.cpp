@@ -0,0 +1,94 @@
+/** @file TestSearchObserver.cpp
+ *
+ * Implementa testes para os observadores de buscas (IIA::Search::SearchStats
+ * e IIA::Search::JsonLinesExporter).
+ *
+ * @author Guilherme N. Ramos (gnramos@unb.br)
+ * @date 10/2026 */
+
+#include <assert.h>
+#include <sstream>
+
+#include "../TestProblem.h"
+#include "AStarSearch.h"
+#include "BreadthFirstSearch.h"
+#include "SearchObserver.hpp"
+#include "UniformCostSearch.h"
+
+using namespace IIA::Search;
+typedef IIA::Test::State::Integer Integer;
+typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+
+// Contadores coerentes com o resultado da busca.
+void check_stats(const SearchStats &stats, const Result<Integer> &result) {
+	assert(result.status == Result<Integer>::SUCCESS);
+	assert(stats.generated_nodes + 1 == result.expanded_nodes);
+	assert(stats.expanded_nodes > 0);
+	assert(stats.peak_frontier > 0);
+	assert(stats.peak_memory > 0);
+	for(int p = 0; p < NUM_PHASES; ++p) assert(stats.phase_ns[p] >= 0);
+}
+
+void test_SearchStats() {
+	ZeroToFour problem;
+
+	SearchStats tree;
+	check_stats(tree, Uninformed::BreadthFirst::search_tree(problem, tree));
+	assert(tree.pruned_nodes == 0);
+
+	SearchStats graph;
+	Result<Integer> result = Uninformed::BreadthFirst::search_graph(problem, graph);
+	check_stats(graph, result);
+	assert(graph.pruned_nodes > 0);
+	assert(result.expanded_nodes == Uninformed::BreadthFirst::search_graph(problem).expanded_nodes);
+
+	SearchStats uniform;
+	result = Uninformed::UniformCost::search(problem, uniform);
+	check_stats(uniform, result);
+	assert(uniform.pruned_nodes > 0);
+	assert(result.expanded_nodes == Uninformed::UniformCost::search(problem).expanded_nodes);
+
+	// mesmos contadores de AStar::Counters
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	Informed::HeuristicCalc<Integer> zero(&encoded.goal_states);
+	Informed::AStar::Counters counters;
+	SearchStats astar;
+	result = Informed::AStar::search(encoded, zero, astar, Informed::AStar::HIGHER_G, 0, &counters);
+	check_stats(astar, result);
+	assert(astar.expanded_nodes == counters.expanded_nodes);
+	assert(astar.generated_nodes == counters.generated_nodes);
+	assert(astar.reopened_nodes == counters.reopened_nodes);
+}
+
+void test_JsonLinesExporter() {
+	ZeroToFour problem;
+	SearchStats stats;
+	Result<Integer> result = Uninformed::UniformCost::search(problem, stats);
+
+	std::ostringstream output;
+	JsonLinesExporter exporter(output);
+	exporter.write({{"problem", "ZeroToFour"}, {"search", "UniformCost"}}, stats, result);
+	exporter.write({{"note", "\"quoted\"\\\n"}}, stats);
+
+	std::istringstream lines(output.str());
+	std::string line;
+	std::getline(lines, line);
+	assert(line.find("{\"problem\":\"ZeroToFour\",\"search\":\"UniformCost\",\"status\":\"Success\",\"depth\":3,\"cost\":1.75,") == 0);
+	std::ostringstream expected;
+	expected << "\"generated\":" << stats.generated_nodes << ",\"expanded\":" << stats.expanded_nodes;
+	assert(line.find(expected.str()) != std::string::npos);
+	assert(line.find("\"cpu_ns\":{\"selection\":") != std::string::npos);
+	assert(line[line.size() - 1] == '}');
+
+	std::getline(lines, line);
+	assert(line.find("{\"note\":\"\\\"quoted\\\"\\\\\\n\",\"generated\":") == 0);
+
+	assert(!std::getline(lines, line));
+}
+
+int main(int argc, char **argv) {
+	test_SearchStats();
+	test_JsonLinesExporter();
+
+	return 0;
+}
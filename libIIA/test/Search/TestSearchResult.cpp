@@ -7,6 +7,7 @@
 
 #include <assert.h>
 #include <iostream>
+#include <utility>
 
 #include "../TestProblem.h"
 #include "SearchResult.hpp"
@@ -58,7 +59,36 @@ void test_ctor(){
 }
 
 void test_operator_equal() {
-	/** @todo implementar teste de operador = */
+	using namespace Uninformed;
+
+	Node<Integer> node(Integer(0));
+	Add add(1);
+	Node<Integer> *child = child_node<Integer>(&node, &add);
+	Node<Integer> *grandchild = child_node(child, &add);
+
+	// cópia: ações clonadas
+	Result<Integer> result(Result<Integer>::SUCCESS, grandchild, 3);
+	Result<Integer> copy(Result<Integer>::CUTOFF);
+	copy = result;
+	assert(copy.status == Result<Integer>::SUCCESS);
+	assert(copy.expanded_nodes == 3);
+	assert(copy.actions.size() == 2);
+	assert(copy.actions[0] != result.actions[0]);
+
+	// movimentação: ações transferidas, sem clonagem
+	IIA::Action<Integer> *first = result.actions[0];
+	Result<Integer> moved(std::move(result));
+	assert(moved.status == Result<Integer>::SUCCESS);
+	assert(moved.actions.size() == 2 && moved.actions[0] == first);
+	assert(result.actions.empty());
+
+	copy = std::move(moved);
+	assert(copy.actions.size() == 2 && copy.actions[0] == first);
+	assert(copy.expanded_nodes == 3);
+	assert(moved.actions.empty());
+
+	delete grandchild;
+	delete child;
 }
 
 	
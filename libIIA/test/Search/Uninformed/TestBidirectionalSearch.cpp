@@ -8,27 +8,32 @@
 #include <assert.h>
 
 #include "BidirectionalSearch.h"
+#include "UniformCostSearch.h"
 
 #include "../../TestProblem.h"
 
 using namespace IIA::Search;
 typedef IIA::Test::State::Integer Integer;
 typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+typedef IIA::Test::Problem::ZeroToThousand ZeroToThousand;
+using IIA::Test::Problem::check_solution;
 
 int main(int argc, char **argv)	{
 	using namespace Uninformed::Bidirectional;
 	
+	// custo ótimo: +1, +1, *2 (e não +1, *2, *2, com o mesmo número de ações)
 	ZeroToFour problem;
+	assert(check_solution(problem, search(problem)) == 1.75);
+
+	ZeroToThousand thousand(true); // objetivos 1000 e -1000
+	assert(check_solution(thousand, search(thousand)) ==
+		   check_solution(thousand, Uninformed::UniformCost::search(thousand)));
+
+	// o estado inicial já é objetivo
+	problem.goal_states.insert(problem.initial_state);
 	Result<Integer> result = search(problem);
-		
-	assert(result.status == Result<Integer>::SUCCESS);
-	assert(!result.actions.empty());
-	assert(result.expanded_nodes > 0);
-
-	Integer state = problem.initial_state;
-	for(IIA::Action<Integer> *action : result.actions) 
-		action->execute(state);
-	assert(problem.is_goal(state));
+	assert(check_solution(problem, result) == 0);
+	assert(result.actions.empty());
 
 	return 0;
 }
@@ -6,6 +6,7 @@
  * @date 05/2012 */
 
 #include <assert.h>
+#include <stdexcept>
 
 #include "../../TestProblem.h"
 #include "BreadthFirstSearch.h"
@@ -13,8 +14,9 @@
 using namespace IIA::Search;
 typedef IIA::Test::State::Integer Integer;
 typedef IIA::Test::Problem::ZeroToFour ZeroToFour;
+typedef IIA::Test::Problem::ZeroToThousand ZeroToThousand;
 
-void test_search(const ZeroToFour &problem, IIA::Search::Result<Integer> (*search)(const IIA::Problem<Integer> &)) {
+void test_search(const IIA::Problem<Integer> &problem, IIA::Search::Result<Integer> (*search)(const IIA::Problem<Integer> &)) {
 	Result<Integer> result = search(problem);
 		
 	assert(result.status == Result<Integer>::SUCCESS);
@@ -27,6 +29,73 @@ void test_search(const ZeroToFour &problem, IIA::Search::Result<Integer> (*searc
 	assert(problem.is_goal(state));
 }
 
+// Estado sem StateHash: parallel_search_graph recai na busca sequencial.
+class Unhashed : public IIA::State<Unhashed> {
+public:
+	Unhashed(int num = 0) : number(num) {}
+
+	bool operator< (const Unhashed &that) const { return this->number < that.number; }
+	bool operator== (const Unhashed &that) const { return this->number == that.number; }
+	Unhashed &operator= (const Unhashed &that) {
+		this->number = that.number;
+		return *this;
+	}
+	friend std::ostream &operator <<(std::ostream &os, const Unhashed &state) {
+		os << state.number;
+		return os;
+	}
+
+	int number;
+};
+
+// Adiciona o número especificado ao estado.
+class Step : public IIA::Action<Unhashed> {
+public:
+	Step(int num) : IIA::Action<Unhashed>(1), number(num) {}
+	Step *clone() const { return new Step(number); }
+	void execute(Unhashed &state) const { state.number += number; }
+	std::string to_string() const { return IIA::Utils::String::to_string(number); }
+
+	int number;
+};
+
+// Partir de 0 e chegar a 4, com as ações +1 e -1.
+class UnhashedProblem : public IIA::Problem<Unhashed> {
+public:
+	UnhashedProblem() : IIA::Problem<Unhashed>(Unhashed(0), Unhashed(4)) {}
+
+	std::deque<IIA::Action<Unhashed> *> actions(const Unhashed &state) const {
+		std::deque<IIA::Action<Unhashed> *> actions;
+		actions.push_back(new Step(1)), actions.push_back(new Step(-1));
+		return actions;
+	}
+};
+
+// A busca paralela encontra uma solução de mesma profundidade que a
+// sequencial, com qualquer número de threads.
+template <class state_t>
+void test_parallel_search_graph(const IIA::Problem<state_t> &problem) {
+	using namespace Uninformed::BreadthFirst;
+
+	const Result<state_t> sequential = search_graph(problem);
+	for(unsigned int workers : {1, 2, 3, 8}) {
+		Result<state_t> result = parallel_search_graph(problem, workers);
+		assert(result.status == Result<state_t>::SUCCESS);
+		assert(result.actions.size() == sequential.actions.size());
+		assert(result.expanded_nodes > 0);
+
+		state_t state = problem.initial_state;
+		for(IIA::Action<state_t> *action : result.actions)
+			action->execute(state);
+		assert(problem.is_goal(state));
+	}
+
+	try {
+		parallel_search_graph(problem, 0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+}
+
 int main(int argc, char **argv) {
 	using namespace Uninformed::BreadthFirst;
 	
@@ -35,5 +104,21 @@ int main(int argc, char **argv) {
 	test_search(problem, search_tree);
 	test_search(problem, search_graph);
 
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	test_search(encoded, search_tree);
+	test_search(encoded, search_graph);
+	assert(search_graph(encoded).expanded_nodes == search_graph(problem).expanded_nodes);
+
+	test_parallel_search_graph(problem);
+	test_parallel_search_graph(encoded);
+	test_parallel_search_graph(ZeroToThousand());
+	assert(parallel_search_graph(encoded, 1).expanded_nodes == search_graph(encoded).expanded_nodes);
+
+	// sem StateHash: mesma busca que search_graph
+	UnhashedProblem unhashed;
+	assert(!IIA::StateHash<Unhashed>::enabled);
+	test_parallel_search_graph(unhashed);
+	assert(parallel_search_graph(unhashed, 8).expanded_nodes == search_graph(unhashed).expanded_nodes);
+
 	return 0;
 }
@@ -27,6 +27,18 @@ int main(int argc, char **argv)	{
 	for(IIA::Action<Integer> *action : result.actions) 
 		action->execute(state);
 	assert(problem.is_goal(state));
-	
+
+	// problema codificado: mesma busca, sem alocação de ações
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	Result<Integer> compact = Uninformed::IterativeDeepening::search(encoded);
+	assert(compact.status == Result<Integer>::SUCCESS);
+	assert(compact.actions.size() == result.actions.size());
+	assert(compact.expanded_nodes == result.expanded_nodes);
+
+	state = encoded.initial_state;
+	for(IIA::Action<Integer> *action : compact.actions)
+		action->execute(state);
+	assert(encoded.is_goal(state));
+
 	return 0;
 }
@@ -26,6 +26,15 @@ int main(int argc, char **argv)	{
 	for(IIA::Action<Integer> *action : result.actions) 
 		action->execute(state);
 	assert(problem.is_goal(state));
+
+	// nós compactos: mesma solução
+	IIA::Test::Problem::EncodedZeroToFour encoded;
+	Result<Integer> compact = Uninformed::UniformCost::search(encoded);
+	assert(compact.status == Result<Integer>::SUCCESS);
+	assert(compact.actions.size() == result.actions.size());
+	assert(compact.expanded_nodes == result.expanded_nodes);
+	for(unsigned int i = 0; i < result.actions.size(); ++i)
+		assert(compact.actions[i]->to_string() == result.actions[i]->to_string());
 	
 	return 0;
 }
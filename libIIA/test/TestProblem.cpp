@@ -39,9 +39,56 @@ void test_actions() {
 	IIA::Utils::empty(actions);
 }
 
+void test_encoded() {
+	Problem::EncodedZeroToFour problem;
+	State::Integer state(2);
+
+	// actions() decodifica as ações aplicáveis, na ordem dos identificadores
+	std::deque<IIA::Action<State::Integer> *> actions = problem.actions(state);
+	assert(actions.size() == problem.num_actions());
+	for(IIA::ActionId id = 0; id < problem.num_actions(); ++id) {
+		State::Integer decoded(2), encoded(2);
+		actions[id]->execute(decoded);
+		problem.execute(encoded, id);
+		assert(decoded == encoded);
+		assert(actions[id]->cost == problem.cost(id));
+	}
+	IIA::Utils::empty(actions);
+}
+
+// Armazena os sucessores recebidos, interrompendo após o limite dado.
+class CollectSink : public IIA::SuccessorSink<State::Integer> {
+public:
+	CollectSink(unsigned int max) : limit(max) {}
+	bool operator()(const State::Integer &successor, IIA::ActionId id, double cost) {
+		successors.push_back(successor), ids.push_back(id);
+		return successors.size() < limit;
+	}
+	unsigned int limit;
+	std::deque<State::Integer> successors;
+	std::deque<IIA::ActionId> ids;
+};
+
+void test_for_each_successor() {
+	Problem::EncodedZeroToFour problem;
+
+	CollectSink all(10);
+	problem.for_each_successor(State::Integer(3), all);
+	assert(all.successors.size() == 3);
+	assert(all.successors[0].number == 4 && all.ids[0] == 0);
+	assert(all.successors[1].number == 2 && all.ids[1] == 1);
+	assert(all.successors[2].number == 6 && all.ids[2] == 2);
+
+	CollectSink first(1);
+	problem.for_each_successor(State::Integer(3), first);
+	assert(first.successors.size() == 1);
+}
+
 int main(int argc, char **argv)	{
 	test_ctor();
 	test_actions();
+	test_encoded();
+	test_for_each_successor();
 	
 	return 0;
 }
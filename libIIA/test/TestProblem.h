@@ -8,7 +8,12 @@
 #ifndef IIA_TEST_PROBLEM_H
 #define IIA_TEST_PROBLEM_H
 
+#include <assert.h>
+#include <cstdlib> // std::abs
+
+#include "EncodedProblem.hpp"
 #include "Problem.hpp"
+#include "SearchResult.hpp"
 
 #include "TestAction.h"
 
@@ -49,6 +54,81 @@ public:
 		return result;
 	}
 };
+
+/** Define o mesmo problema que ZeroToFour, com ações codificadas: 0 (+1),
+ * 1 (-1) e 2 (*2). */
+class EncodedZeroToFour : public IIA::EncodedProblem<Integer> {
+public:
+	/** O estado inicial é 0 e os objetivos são 4 e -4 (hardcoded). */
+	EncodedZeroToFour() : IIA::EncodedProblem<Integer>(Integer(0), Integer(0)) {
+		goal_states.clear();
+		goal_states.insert(Integer(4));
+		goal_states.insert(Integer(-4));
+	}
+
+	unsigned int num_actions() const { return 3; }
+	bool applicable(const Integer &state, ActionId id) const { return true; }
+	void execute(Integer &state, ActionId id) const {
+		if(id == 2) state.number *= 2;
+		else state.number += (id == 0 ? 1 : -1);
+	}
+	double cost(ActionId id) const { return (id == 2 ? 0.75 : 0.5); }
+	IIA::Action<Integer> *decode(ActionId id) const {
+		if(id == 2) return new Action::Multiply(2);
+		return new Action::Add(id == 0 ? 1 : -1);
+	}
+};
+
+/** Define o mesmo problema que EncodedZeroToFour, com objetivo distante
+ * (1000, e também -1000 se indicado). As ações que levariam o valor além de
+ * LIMIT (em módulo) não são aplicáveis, para que buscas que expandem além do
+ * objetivo (ex: HDAStar) não estourem o inteiro com *2. */
+class ZeroToThousand : public EncodedZeroToFour {
+public:
+	/** O maior valor (em módulo) dos estados. */
+	static const int LIMIT = 1000;
+
+	/** O estado inicial é 0 e o objetivo é 1000 (e -1000, se negative). */
+	ZeroToThousand(bool negative = false) {
+		goal_states.clear();
+		goal_states.insert(Integer(LIMIT));
+		if(negative) goal_states.insert(Integer(-LIMIT));
+	}
+
+	bool applicable(const Integer &state, ActionId id) const {
+		Integer next(state);
+		execute(next, id);
+		return (std::abs(next.number) <= LIMIT);
+	}
+	/** Os predecessores de ZeroToFour que respeitam o limite. */
+	std::deque<std::pair<Integer, IIA::Action<Integer> *> > predecessors(const Integer &state) const {
+		std::deque<std::pair<Integer, IIA::Action<Integer> *> > result;
+
+		if((state.number%2) == 0)
+			result.push_back(std::pair<Integer, IIA::Action<Integer> *>(Integer(state.number/2), new Action::Multiply(2)));
+		if(state.number < LIMIT)
+			result.push_back(std::pair<Integer, IIA::Action<Integer> *>(Integer(state.number+1), new Action::Add(-1)));
+		if(state.number > -LIMIT)
+			result.push_back(std::pair<Integer, IIA::Action<Integer> *>(Integer(state.number-1), new Action::Add(1)));
+
+		return result;
+	}
+};
+
+/** Verifica que a busca teve sucesso e que suas ações levam o estado inicial
+ * do problema a um objetivo, e retorna o custo da solução. */
+inline double check_solution(const IIA::Problem<Integer> &problem, const IIA::Search::Result<Integer> &result) {
+	assert(result.status == IIA::Search::Result<Integer>::SUCCESS);
+	assert(result.expanded_nodes > 0);
+
+	double cost = 0;
+	Integer state = problem.initial_state;
+	for(IIA::Action<Integer> *action : result.actions)
+		action->execute(state), cost += action->cost;
+	assert(problem.is_goal(state));
+
+	return cost;
+}
 } // namespace Problem
 } // namespace Test
 } // namespace IIA
@@ -48,11 +48,21 @@ void test_operator_attr() {
 	assert(state1 == state2);
 }
 
+// Testa a especialização de IIA::StateHash.
+void test_hash() {
+	IIA::StateHash<Integer> hash;
+	assert(IIA::StateHash<Integer>::enabled);
+	assert(hash(Integer(1)) == hash(Integer(1)));
+	assert(hash(Integer(1)) != hash(Integer(2)));
+	assert(!IIA::StateHash<int>::enabled);
+}
+
 int main(int argc, char **argv)	{
 	test_ctor();
 	test_operator_lt();
 	test_operator_eq();
 	test_operator_attr();
+	test_hash();
 	
 	return 0;
 }
@@ -40,6 +40,17 @@ public:
 };
 } // namespace State
 } // namespace Test
+
+/** Especialização de StateHash para o estado de testes. */
+template <>
+struct StateHash<Test::State::Integer> {
+	/** Indica que há função de espalhamento para o estado. */
+	static const bool enabled = true;
+	/** Retorna o valor de espalhamento do estado. */
+	std::size_t operator()(const Test::State::Integer &state) const {
+		return static_cast<std::size_t>(state.number);
+	}
+};
 } // namespace IIA
 
 #endif // IIA_TEST_STATE_H
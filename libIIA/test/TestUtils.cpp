@@ -9,8 +9,12 @@
 #define IIA_TEST_UTILS_H
 
 #include <assert.h>
+#include <atomic>
 #include <deque>
+#include <thread>
 
+#include "Mailbox.h"
+#include "ThreadPool.h"
 #include "Utils.h"
 
 using namespace IIA::Utils;
@@ -51,6 +55,51 @@ void test_Random() {
 	}
 }
 
+void test_Random_Generator() {
+	using namespace Random;
+
+	// mesma semente e fluxo: mesma sequência
+	Generator g1(42, 7), g2(42, 7), g3(42, 8), g4(43, 7);
+	bool differs_stream = false, differs_seed = false;
+	for(int j = 0; j < 100; ++j) {
+		uint64_t x = g1();
+		assert(x == g2());
+		differs_stream |= (x != g3());
+		differs_seed |= (x != g4());
+	}
+	assert(differs_stream && differs_seed);
+
+	g1.set_seed(42, 7), g2.set_seed(42, 7);
+	for(int j = 0; j < 1000; ++j) {
+		int i = g1.get_random_int(6, -3);
+		assert(-3 <= i && i <= 6);
+		assert(i == g2.get_random_int(6, -3));
+
+		double d = g1.get_uniform();
+		assert(0 <= d && d < 1);
+		g2.get_uniform();
+
+		d = g1.get_random_dbl(0.85, 0.05);
+		assert(0.05 <= d && d <= 0.85);
+		g2.get_random_dbl(0.85, 0.05);
+	}
+
+	// todos os valores do intervalo são sorteados
+	std::deque<int> count(4, 0);
+	for(int j = 0; j < 4000; ++j) ++count[g1.get_random_int(3)];
+	for(int c : count) assert(c > 800);
+
+	// cada thread tem seu próprio gerador
+	thread_generator().set_seed(1, 2);
+	uint64_t main_value = Generator(1, 2)();
+	std::thread other([]() {
+		thread_generator().set_seed(3, 4);
+		assert(thread_generator()() == Generator(3, 4)());
+	});
+	other.join();
+	assert(thread_generator()() == main_value);
+}
+
 void test_String() {
 	using namespace String;
 
@@ -100,6 +149,69 @@ void test_Time() {
 	assert(to_mili(diff) == 60*THOUSAND);
 	assert(to_sec(diff) == 60);
 	assert(to_min(diff) == 1);
+
+	get_thread_cpu_time(start_time);
+	for(volatile int i = 0; i < 100000; ++i);
+	get_thread_cpu_time(end_time);
+	assert(end_time.tv_sec > start_time.tv_sec ||
+		   end_time.tv_nsec > start_time.tv_nsec);
+}
+
+void test_ThreadPool() {
+	try {
+		ThreadPool pool(0);
+		assert(false);
+	} catch(std::invalid_argument e) {}
+
+	ThreadPool pool(4);
+	assert(pool.size() == 4);
+	assert(ThreadPool::hardware_workers() >= 1);
+
+	std::atomic<int> sum(0);
+	std::deque<int> values(100, 0);
+	for(int i = 0; i < 100; ++i)
+		pool.submit([&sum, &values, i]() { values[i] = i, sum += i; });
+	pool.wait();
+	assert(sum == 4950);
+	for(int i = 0; i < 100; ++i) assert(values[i] == i);
+
+	// a primeira exceção é relançada, e as demais tarefas são executadas
+	pool.submit([]() { throw std::runtime_error("task"); });
+	pool.submit([&sum]() { ++sum; });
+	try {
+		pool.wait();
+		assert(false);
+	} catch(std::runtime_error e) {}
+	assert(sum == 4951);
+
+	pool.wait(); // erro já relançado
+}
+
+void test_Mailbox() {
+	Mailbox<std::deque<int> > mailbox;
+	assert(mailbox.empty());
+	assert(mailbox.receive([](std::deque<int> &) { assert(false); }) == 0);
+
+	// vários remetentes, um destinatário
+	std::deque<std::thread> senders;
+	for(int t = 0; t < 4; ++t)
+		senders.push_back(std::thread([&mailbox, t]() {
+			for(int i = 0; i < 1000; ++i) mailbox.send(std::deque<int>(1, t * 1000 + i));
+		}));
+
+	std::deque<bool> received(4000, false);
+	unsigned int n = 0;
+	while(n < 4000)
+		n += mailbox.receive([&received](std::deque<int> &message) {
+			assert(!received[message.front()]);
+			received[message.front()] = true;
+		});
+	for(std::thread &sender : senders) sender.join();
+
+	assert(mailbox.empty());
+	for(bool r : received) assert(r);
+
+	mailbox.send(std::deque<int>(3, 0)); // descartada pelo destrutor
 }
 
 int main(int argc, char **argv)	{
@@ -107,8 +219,11 @@ int main(int argc, char **argv)	{
 	test_contains();
 	
 	test_Random();
+	test_Random_Generator();
 	test_String();
 	test_Time();
+	test_ThreadPool();
+	test_Mailbox();
 	
 	return 0;
 }
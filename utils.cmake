@@ -125,11 +125,25 @@ endmacro ()
 		############
 
 # Gerar um exemplo a partir de todos os arquivos dentro do diretório dado. Bibliotecas 
-# necessárias são fornecidas como argumentos adicionais.
+# necessárias são fornecidas como argumentos adicionais. O arquivo de teste do
+# exemplo (Test<exemplo>.cpp), se houver, gera um teste à parte.
 macro (ADD_CUSTOM_EXAMPLE EXAMPLE_DIR EXAMPLE_NAME)
 	file (GLOB ${EXAMPLE_NAME}_SRC ${EXAMPLE_DIR}/${EXAMPLE_NAME}/*.cpp)	
+
+	# Remover o arquivo de teste
+	set (${EXAMPLE_NAME}_TEST OFF)
+	foreach (EXAMPLE_FILE ${${EXAMPLE_NAME}_SRC})
+		if (${EXAMPLE_FILE} MATCHES "Test${EXAMPLE_NAME}.cpp")
+			list (REMOVE_ITEM ${EXAMPLE_NAME}_SRC ${EXAMPLE_FILE})
+			set (${EXAMPLE_NAME}_TEST ON)
+		endif ()
+	endforeach ()
+
 	add_executable (${EXAMPLE_NAME} ${${EXAMPLE_NAME}_SRC})
 	target_link_libraries (${EXAMPLE_NAME} ${ARGN})
+	if (${EXAMPLE_NAME}_TEST)
+		add_custom_test (${EXAMPLE_DIR}/${EXAMPLE_NAME} Test${EXAMPLE_NAME} ${ARGN})
+	endif ()
 endmacro ()
 
 # Gerar exemplos a partir de um diretório. Supõe-se que cada exemplo está organizado